@@ -75,6 +75,15 @@ class CI_API BufferObj {
 	void*				mapBufferRange( GLintptr offset, GLsizeiptr length, GLbitfield access ) const;
 #endif
 
+#if defined( CINDER_GL_HAS_BUFFER_STORAGE )
+	//! Analogous to glBufferStorage(). Allocates an immutable data store of \a size bytes; unlike bufferData() the store may not be reallocated afterward. Requires OpenGL 4.4 or \c ARB_buffer_storage.
+	void				bufferStorage( GLsizeiptr size, const GLvoid *data, GLbitfield flags );
+	//! Maps the entire data store with \a access, which must include \c GL_MAP_PERSISTENT_BIT, and retains the pointer. The mapping remains valid while the buffer is in use by GL until unmap() is called. Requires a store allocated via bufferStorage() with matching flags.
+	void*				mapPersistent( GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT );
+	//! Returns the pointer established by mapPersistent(), or \c nullptr if the buffer is not persistently mapped.
+	void*				getPersistentPtr() const { return mPersistentPtr; }
+#endif
+
 #if defined( CINDER_GL_HAS_MAP_BUFFER ) || defined( CINDER_GL_HAS_MAP_BUFFER_RANGE )
 	void				unmap() const;
 #endif
@@ -104,6 +113,9 @@ class CI_API BufferObj {
 	GLsizeiptr			mSize;
 	GLenum				mTarget;
 	GLenum				mUsage;
+#if defined( CINDER_GL_HAS_BUFFER_STORAGE )
+	mutable void		*mPersistentPtr = nullptr;
+#endif
 	std::string			mLabel; // debug label
 	
 	friend CI_API std::ostream& operator<<( std::ostream &os, const BufferObj &rhs );
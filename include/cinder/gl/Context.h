@@ -232,6 +232,8 @@ class CI_API Context {
 	void bindBufferBase( GLenum target, GLuint index, GLuint id );
 	//! Analogous to glBindBufferRange()
 	void bindBufferRange( GLenum target, GLuint index, const BufferObjRef &buffer, GLintptr offset, GLsizeiptr size );
+	//! Analogous to glBindBufferRange()
+	void bindBufferRange( GLenum target, GLuint index, GLuint id, GLintptr offset, GLsizeiptr size );
 #endif // ! defined( CINDER_GL_ES_2 )
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
 	//! Binds \a feedbackObj as the current Transform Feedback Object. Also, unbinds currently bound Transform Feedback Obj if one exists.
@@ -24,12 +24,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <sstream>
-#include <iostream>
-#include <fstream>
-#include <map>
-#include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "cinder/gl/wrapper.h"
 #include "cinder/gl/ShaderPreprocessor.h"
@@ -44,13 +46,34 @@
 //! If available on all target platforms, users should use C+11 raw string literals, which do not suffer from the same limitations.
 #define CI_GLSL(VERSION,CODE) "#version " #VERSION "\n" #CODE
 
+//! Creates a cinder::gl::UniformId from a string literal, hashing the name at compile time.
+#define CI_UNIFORM_ID(NAME) cinder::gl::UniformId{ cinder::gl::detail::constHash( NAME ), NAME }
+
+//! Creates a cinder::gl::GlslProg::UniformBinding mapping member \a MEMBER of \a STRUCT to the GLSL uniform named \a NAME, for use with GlslProg::makeUniformPusher().
+#define CI_UNIFORM_BINDING(STRUCT,MEMBER,NAME) cinder::gl::GlslProg::UniformBinding{ NAME, offsetof( STRUCT, MEMBER ) }
+
 namespace cinder { namespace gl {
-	
+
 typedef std::shared_ptr<class GlslProg> GlslProgRef;
 
-class UniformValueCache;
 class ShaderPreprocessor;
 
+namespace detail {
+//! FNV-1a 32-bit hash. constexpr so that uniform name literals can be hashed at compile time.
+constexpr uint32_t constHash( const char *str, uint32_t hash = 2166136261u )
+{
+	return ( *str == 0 ) ? hash : constHash( str + 1, ( hash ^ (uint32_t)(uint8_t)*str ) * 16777619u );
+}
+inline uint32_t constHash( const std::string &str ) { return constHash( str.c_str() ); }
+} // namespace detail
+
+//! Precomputed hash of a uniform name, allowing gl::GlslProg::uniform() calls to skip per-call string hashing.
+//! Typically constructed via the CI_UNIFORM_ID() macro, which hashes the name at compile time.
+struct UniformId {
+	uint32_t	hash;
+	const char*	debugName;
+};
+
 class CI_API GlslProg {
   public:
 	struct CI_API Attribute {
@@ -65,14 +88,19 @@ class CI_API GlslProg {
 		GLenum				getType() const { return mType; }
 		//! Returns the defined geom::Attrib semantic.
 		geom::Attrib		getSemantic() const { return mSemantic; }
+		//! Returns the FNV-1a hash of the name, computed once when the attribute is cached.
+		uint32_t			getNameHash() const { return mNameHash; }
 		//! Used to derive the expected layout for cpu types within glsl.
 		static void getShaderAttribLayout( GLenum type, uint32_t *numDimsPerVertexPointer, uint32_t *numLocationsExpected );
 
 	  private:
 		std::string		mName;
-		GLint			mCount = 0, mLoc = -1;
+		uint32_t		mNameHash = 0;
+		GLint			mLoc = -1;
 		GLenum			mType = ~0u;
 		geom::Attrib	mSemantic = geom::Attrib::USER_DEFINED;
+		// bounded by the GL attribute limits; narrowed so the struct packs without padding
+		uint16_t		mCount = 0;
 
 		friend class GlslProg;
 	};
@@ -93,25 +121,45 @@ class CI_API GlslProg {
 		GLenum				getType() const { return mType; }
 		//! Returns the defined UniformSemantic.
 		UniformSemantic		getUniformSemantic() const { return mSemantic; }
-		
+		//! Returns the FNV-1a hash of the name, computed once when the uniform is cached.
+		uint32_t			getNameHash() const { return mNameHash; }
+
 	  private:
 		std::string		mName;
-		GLint			mCount = 0, mLoc = -1, mIndex = -1;
+		uint32_t		mNameHash = 0;
+		GLint			mLoc = -1;
+		//! Used internally for the value cache; byte offset of this uniform's shadowed value.
+		GLint			mBytePointer = 0;
 		GLenum			mType = ~0u;
 		UniformSemantic mSemantic = UniformSemantic::UNIFORM_USER_DEFINED;
-		
+		// The remaining fields are bounded well below 16 bits (counts and indices by the GL
+		// implementation limits, element size by mat4's 64 bytes); narrowing and grouping them
+		// fits the struct in a single cache line, which matters for the linear scans in findUniform().
+		uint16_t		mCount = 0;
+		int16_t			mIndex = -1;
 		//! Used internally for the value cache. Size of a single element.
-		GLint			mTypeSize = 0;
-		//! Used internally for the value cache.
-		GLint			mBytePointer = 0;
-		
+		uint16_t		mTypeSize = 0;
+		//! Used internally for type validation; compressed tag derived from mType once when the uniform is cached.
+		uint8_t			mTypeTag = 0;
+
 		friend class GlslProg;
 	};
 	
 #if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
 
 	struct CI_API UniformBlock {
-		
+
+		//! Per-uniform layout queries for this block, stored contiguously rather than behind a
+		//! std::map of tree nodes; each vector is indexed parallel to getActiveUniforms().
+		struct CI_API UniformBlockInfo {
+			//! Offsets, in basic machine units, relative to the beginning of the uniform block in the buffer object data store. Corresponds to GL_UNIFORM_OFFSET.
+			std::vector<GLint>	mOffsets;
+			//! The difference, in basic machine units, of consecutive elements in an array, or zero for uniforms not declared as an array. Corresponds to GL_UNIFORM_ARRAY_STRIDE.
+			std::vector<GLint>	mArrayStrides;
+			//! The stride between columns of a column-major matrix or rows of a row-major matrix, in basic machine units, or zero for non-matrix uniforms. Corresponds to GL_UNIFORM_MATRIX_STRIDE.
+			std::vector<GLint>	mMatrixStrides;
+		};
+
 		//! Returns a const reference of the name as defined inside the Glsl.
 		const std::string&	getName() const { return mName; }
 		//! Returns the implementation-dependent minimum total buffer object
@@ -126,23 +174,17 @@ class CI_API GlslProg {
 		
 		//! Returns a const reference of all the active uniforms within this uniform block.
 		const std::vector<Uniform>& getActiveUniforms() const { return mActiveUniforms; }
-		//! Returns 3 different aspects of this block for more advanced partitioning of data. Contains
-		//! GL_UNIFORM_OFFSET - array of offsets, in basic machine units, relative to the beginning
-		//! of the uniform block in the buffer object data store, GL_UNIFORM_ARRAY_STRIDE -
-		//! the stride is the difference, in basic machine units, of consecutive elements in
-		//! an array, or zero for uniforms not declared as an array, AND GL_UNIFORM_MATRIX_STRIDE -
-		//! the stride between columns of a column-major matrix or rows of a row-major matrix,
-		//! in basic machine units, of each of the active uniforms, or zero for uniforms not
-		//! declared as an array.
-		std::map<GLenum, std::vector<GLint>> getActiveUniformInfo() const { return mActiveUniformInfo; }
-		
+		//! Returns 3 different aspects of this block for more advanced partitioning of data:
+		//! the offsets, array strides and matrix strides of each of the active uniforms. \sa UniformBlockInfo
+		const UniformBlockInfo&	getActiveUniformInfo() const { return mActiveUniformInfo; }
+
 	  private:
 		std::string				mName;
 		GLint					mDataSize = 0, mLoc = -1;
 		mutable GLint			mBlockBinding;
 		std::vector<Uniform>	mActiveUniforms;
-		std::map<GLenum, std::vector<GLint>> mActiveUniformInfo;
-		
+		UniformBlockInfo		mActiveUniformInfo;
+
 		friend class GlslProg;
 	};
 
@@ -183,16 +225,16 @@ class CI_API GlslProg {
 		//! Supplies the GLSL source for the fragment shader
 		Format&		fragment( const std::string &fragmentShader );
 		//! Returns the GLSL source for the vertex shader. Returns an empty string if it isn't present.
-		const std::string&	getVertex() const { return mVertexShader; }
+		const std::string&	getVertex() const { return mVertexShader ? *mVertexShader : getEmptyString(); }
 		//! Returns the GLSL source for the fragment shader. Returns an empty string if it isn't present.
-		const std::string&	getFragment() const { return mFragmentShader; }
+		const std::string&	getFragment() const { return mFragmentShader ? *mFragmentShader : getEmptyString(); }
 #if defined( CINDER_GL_HAS_GEOM_SHADER )
 		//! Supplies the GLSL source for the geometry shader
 		Format&		geometry( const DataSourceRef &dataSource );
 		//! Supplies the GLSL source for the geometry shader
 		Format&		geometry( const std::string &geometryShader );
 		//! Returns the GLSL source for the geometry shader
-		const std::string&	getGeometry() const { return mGeometryShader; }
+		const std::string&	getGeometry() const { return mGeometryShader ? *mGeometryShader : getEmptyString(); }
 		//! Returns the fs::path for the geometry shader. Returns an empty fs::path if it isn't present.
 		const fs::path&	getGeometryPath() const { return mGeometryShaderPath; }
 #endif // defined( CINDER_GL_HAS_GEOM_SHADER )
@@ -206,9 +248,9 @@ class CI_API GlslProg {
 		//! Supplies the GLSL source for the tessellation control shader
 		Format&		tessellationEval( const std::string &tessellationEvalShader );
 		//! Returns the GLSL source for the tessellation control shader
-		const std::string&	getTessellationCtrl() const { return mTessellationCtrlShader; }
+		const std::string&	getTessellationCtrl() const { return mTessellationCtrlShader ? *mTessellationCtrlShader : getEmptyString(); }
 		//! Returns the GLSL source for the tessellation evaluation shader
-		const std::string&	getTessellationEval() const { return mTessellationEvalShader; }
+		const std::string&	getTessellationEval() const { return mTessellationEvalShader ? *mTessellationEvalShader : getEmptyString(); }
 #endif // defined( CINDER_GL_HAS_TESS_SHADER )
 #if defined( CINDER_GL_HAS_COMPUTE_SHADER )
 		//! Supplies the GLSL source for the compute shader
@@ -216,7 +258,7 @@ class CI_API GlslProg {
 		//! Supplies the GLSL source for the compute shader
 		Format&		compute( const std::string &computeShader );
 		//! Returns the GLSL source for the compute shader. Returns an empty string if it isn't present.
-		const std::string&	getCompute() const { return mComputeShader; }
+		const std::string&	getCompute() const { return mComputeShader ? *mComputeShader : getEmptyString(); }
 		//! Returns the fs::path for the compute shader. Returns an empty fs::path if it isn't present.
 		const fs::path&	getComputePath() const { return mComputeShaderPath; }
 #endif // defined( CINDER_GL_HAS_COMPUTE_SHADER )
@@ -239,8 +281,8 @@ class CI_API GlslProg {
 #if ! defined( CINDER_GL_ES )
 		//! Specifies a binding for a user-defined varying out variable to a fragment shader color number. Analogous to glBindFragDataLocation.
 		Format&		fragDataLocation( GLuint colorNumber, const std::string &name );
-		//! Returns the map between output variable names and their bound color numbers
-		const std::map<std::string,GLuint>&	getFragDataLocations() const { return mFragDataLocations; }
+		//! Returns the pairs of output variable names and their bound color numbers
+		const std::vector<std::pair<std::string,GLuint>>&	getFragDataLocations() const { return mFragDataLocations; }
 #endif
 
 		//! Specifies an attribute name to map to a specific semantic
@@ -273,6 +315,18 @@ class CI_API GlslProg {
 		//! Returns the #version directive that the ShaderPreprocessor will add to shader sources, if they don't contain an explicit `#version` string.
 		int	getVersion() const;
 		
+#if defined( CINDER_GL_HAS_PROGRAM_BINARY )
+		//! Sets a directory used to persist linked program binaries across runs, skipping the GLSL compile & link when a
+		//! cached binary matches. The cache is keyed on the shader sources, preprocessor defines, attrib / frag data /
+		//! transform feedback bindings and driver strings, but does not track the contents of `#include`d files.
+		//! Disabled when empty (the default).
+		void				setBinaryCacheDirectory( const fs::path &directory ) { mBinaryCacheDirectory = directory; }
+		//! Returns the directory used to persist linked program binaries. Empty (disabled) by default.
+		const fs::path&		getBinaryCacheDirectory() const { return mBinaryCacheDirectory; }
+		//! Sets a directory used to persist linked program binaries across runs. \sa setBinaryCacheDirectory()
+		Format&				binaryCacheDirectory( const fs::path &directory ) { setBinaryCacheDirectory( directory ); return *this; }
+#endif
+
 		//! Returns the debugging label associated with the Program.
 		const std::string&	getLabel() const { return mLabel; }
 		//! Sets the debugging label associated with the Program. Calls glObjectLabel() when available.
@@ -291,45 +345,54 @@ class CI_API GlslProg {
 		std::vector<Attribute>&			getAttributes() { return mAttributes; }
 		
 	  protected:
-		void			setShaderSource( const DataSourceRef &dataSource, std::string *shaderSourceDest, fs::path *shaderPathDest );
-		void			setShaderSource( const std::string &source, std::string *shaderSourceDest, fs::path *shaderPathDest );
+		// sources are held as immutable shared strings so that copying a Format (or passing it through the
+		// builder chain) bumps a refcount rather than duplicating kilobytes of shader text
+		typedef std::shared_ptr<const std::string>	ShaderSourceRef;
+
+		void			setShaderSource( const DataSourceRef &dataSource, ShaderSourceRef *shaderSourceDest, fs::path *shaderPathDest );
+		void			setShaderSource( std::string source, ShaderSourceRef *shaderSourceDest, fs::path *shaderPathDest );
+		static const std::string&	getEmptyString();
 
-		std::string		mVertexShader;
-		std::string		mFragmentShader;
+		ShaderSourceRef	mVertexShader;
+		ShaderSourceRef	mFragmentShader;
 
 		fs::path		mVertexShaderPath;
 		fs::path		mFragmentShaderPath;
 
 #if defined( CINDER_GL_HAS_GEOM_SHADER )
-		std::string		mGeometryShader;
+		ShaderSourceRef	mGeometryShader;
 		fs::path		mGeometryShaderPath;
 #endif
 #if defined( CINDER_GL_HAS_TESS_SHADER )
-		std::string		mTessellationCtrlShader;
-		std::string		mTessellationEvalShader;
+		ShaderSourceRef	mTessellationCtrlShader;
+		ShaderSourceRef	mTessellationEvalShader;
 		fs::path		mTessellationCtrlShaderPath;
 		fs::path		mTessellationEvalShaderPath;
 #endif
 #if defined( CINDER_GL_HAS_COMPUTE_SHADER )
-		std::string		mComputeShader;
+		ShaderSourceRef	mComputeShader;
 		fs::path		mComputeShaderPath;
 #endif
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
 		GLenum							mTransformFormat;
 		std::vector<std::string>		mTransformVaryings;
-		std::map<std::string,GLuint>	mFragDataLocations;
+		// flat vector; there are at most a handful of entries (MRT color numbers), so a linear scan beats a node-based map
+		std::vector<std::pair<std::string,GLuint>>	mFragDataLocations;
 #endif
 
 		std::vector<Attribute>			mAttributes;
 		std::vector<Uniform>			mUniforms;
 		std::string						mLabel;
 		ShaderPreprocessorRef			mPreprocessor;
+#if defined( CINDER_GL_HAS_PROGRAM_BINARY )
+		fs::path						mBinaryCacheDirectory;
+#endif
 
 		friend class		GlslProg;
 	};
   
-	typedef std::map<std::string,UniformSemantic>	UniformSemanticMap;
-	typedef std::map<std::string,geom::Attrib>		AttribSemanticMap;
+	typedef std::unordered_map<std::string,UniformSemantic>	UniformSemanticMap;
+	typedef std::unordered_map<std::string,geom::Attrib>	AttribSemanticMap;
 
 	static GlslProgRef create( const Format &format );
 
@@ -413,7 +476,56 @@ class CI_API GlslProg {
 	void	uniform( int location, const mat2 *data, int count, bool transpose = false ) const;
 	void	uniform( int location, const mat3 *data, int count, bool transpose = false ) const;
 	void	uniform( int location, const mat4 *data, int count, bool transpose = false ) const;
-	
+
+	// UniformId variants; resolve the uniform by its precomputed name hash, skipping per-call string hashing.
+	// Construct the UniformId once via CI_UNIFORM_ID( "name" ) and reuse it across frames.
+	void	uniform( const UniformId &id, bool data ) const;
+	void	uniform( const UniformId &id, int data ) const;
+	void	uniform( const UniformId &id, float data ) const;
+#if ! defined( CINDER_GL_ES_2 )
+	void	uniform( const UniformId &id, uint32_t data ) const;
+	void	uniform( const UniformId &id, const uvec2 &data ) const;
+	void	uniform( const UniformId &id, const uvec3 &data ) const;
+	void	uniform( const UniformId &id, const uvec4 &data ) const;
+	void	uniform( const UniformId &id, const uint32_t *data, int count ) const;
+#endif // ! defined( CINDER_GL_ES_2 )
+	void	uniform( const UniformId &id, const vec2 &data ) const;
+	void	uniform( const UniformId &id, const vec3 &data ) const;
+	void	uniform( const UniformId &id, const vec4 &data ) const;
+	void	uniform( const UniformId &id, const ivec2 &data ) const;
+	void	uniform( const UniformId &id, const ivec3 &data ) const;
+	void	uniform( const UniformId &id, const ivec4 &data ) const;
+	void	uniform( const UniformId &id, const mat2 &data, bool transpose = false ) const;
+	void	uniform( const UniformId &id, const mat3 &data, bool transpose = false ) const;
+	void	uniform( const UniformId &id, const mat4 &data, bool transpose = false ) const;
+	void	uniform( const UniformId &id, const int *data, int count ) const;
+	void	uniform( const UniformId &id, const float *data, int count ) const;
+	void	uniform( const UniformId &id, const ivec2 *data, int count ) const;
+	void	uniform( const UniformId &id, const vec2 *data, int count ) const;
+	void	uniform( const UniformId &id, const vec3 *data, int count ) const;
+	void	uniform( const UniformId &id, const vec4 *data, int count ) const;
+	void	uniform( const UniformId &id, const mat2 *data, int count, bool transpose = false ) const;
+	void	uniform( const UniformId &id, const mat3 *data, int count, bool transpose = false ) const;
+	void	uniform( const UniformId &id, const mat4 *data, int count, bool transpose = false ) const;
+
+	//! Describes a binding between the member at \a byteOffset inside a caller-defined struct and the GLSL uniform named \a uniformName. Typically constructed via the CI_UNIFORM_BINDING() macro. Used with makeUniformPusher().
+	struct CI_API UniformBinding {
+		const char	*mUniformName;
+		size_t		mByteOffset;
+	};
+
+	typedef std::function<void ( const void *uniformStruct )>	UniformPusher;
+
+	//! Builds a function which pushes the bound members of a caller-defined struct to this program's uniforms. Locations, types and setters are resolved once here, so invoking the result performs no name lookup or type validation; values still route through the uniform value cache. Bindings naming an inactive uniform are dropped with a warning. The program must be bound when the returned function is invoked, and the function references this GlslProg's internal state, so it must not outlive the GlslProg (hold the GlslProgRef alongside a stored pusher). GLSL bool uniforms must be represented as int32_t members.
+	UniformPusher	makeUniformPusher( const std::vector<UniformBinding> &bindings ) const;
+	//! Typed convenience over makeUniformPusher(); the returned function takes the struct whose members \a bindings describe.
+	template<typename UniformStruct>
+	std::function<void ( const UniformStruct & )>	makePusher( const std::vector<UniformBinding> &bindings ) const
+	{
+		UniformPusher pusher = makeUniformPusher( bindings );
+		return [pusher]( const UniformStruct &uniforms ) { pusher( &uniforms ); };
+	}
+
 	bool	hasAttribSemantic( geom::Attrib semantic ) const;
 	GLint	getAttribSemanticLocation( geom::Attrib semantic ) const;
 	GLint	operator[]( geom::Attrib sem ) const { return getAttribSemanticLocation( sem ); }
@@ -437,6 +549,8 @@ class CI_API GlslProg {
 	const std::vector<Uniform>&		getActiveUniforms() const { return mUniforms; }
 	//! Returns a const pointer to the Uniform that matches \a name. Returns nullptr if the uniform doesn't exist. The uniform location (accounting for indices, like "example[2]") is stored in \a resultLocation if it's non-null.
 	const Uniform*					findUniform( const std::string &name, int *resultLocation ) const;
+	//! Returns a const pointer to the Uniform whose name hash matches \a id. Returns nullptr if the uniform doesn't exist. The uniform location is stored in \a resultLocation if it's non-null.
+	const Uniform*					findUniform( const UniformId &id, int *resultLocation ) const;
 
 #if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
 	//! Analogous to glUniformBlockBinding()
@@ -450,13 +564,13 @@ class CI_API GlslProg {
 	//! Returns a const pointer to the UniformBlock that matches \a name. Returns nullptr if the uniform block doesn't exist.
 	const UniformBlock* findUniformBlock( const std::string &name ) const;
 	//! Returns a const reference to the UniformBlock cache.
-	const std::vector<UniformBlock>& getActiveUniformBlocks() const { return mUniformBlocks; }
+	const std::vector<UniformBlock>& getActiveUniformBlocks() const { cacheActiveUniformBlocks(); return mUniformBlocks; }
 #endif // defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
 	//! Returns a const pointer to the TransformFeedbackVarying that matches \a name. Returns nullptr if the transform feedback varying doesn't exist.
 	const TransformFeedbackVaryings* findTransformFeedbackVaryings( const std::string &name ) const;
 	//! Returns a const reference to the TransformFeedbackVaryings cache.
-	const std::vector<TransformFeedbackVaryings>& getActiveTransformFeedbackVaryings() const { return mTransformFeedbackVaryings; }
+	const std::vector<TransformFeedbackVaryings>& getActiveTransformFeedbackVaryings() const { cacheActiveTransformFeedbackVaryings(); return mTransformFeedbackVaryings; }
 #endif // defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )	
 	std::string		getShaderLog( GLuint handle ) const;
 
@@ -474,6 +588,12 @@ class CI_API GlslProg {
 	void			bindImpl() const;
 	GLuint			loadShader( const std::string &shaderSource, const fs::path &shaderPath, GLint shaderType, const ShaderPreprocessorRef &preprocessor );
 	void			link();
+#if defined( CINDER_GL_HAS_PROGRAM_BINARY )
+	//! Attempts to restore the linked program from \a binaryPath via glProgramBinary(). Returns whether the restored program linked.
+	bool			loadProgramBinary( const fs::path &binaryPath );
+	//! Retrieves the linked program binary via glGetProgramBinary() and writes it atomically to \a binaryPath.
+	void			saveProgramBinary( const fs::path &binaryPath ) const;
+#endif
 	
 	//! Caches all active Attributes after linking.
 	void			cacheActiveAttribs();
@@ -509,9 +629,13 @@ class CI_API GlslProg {
 	template<typename T>
 	void			uniformMatFunc( int location, const T *data, int count, bool transpose ) const;
 	
+	//! Returns true if \a name was already recorded as logged; records it otherwise.
+	bool			isUniformLogged( const std::string &name ) const;
 	//! Logs an error and caches the name.
 	void			logMissingUniform( const std::string &name ) const;
 	//! Logs an error and caches the name.
+	void			logMissingUniform( const UniformId &id ) const;
+	//! Logs an error and caches the name.
 	void			logMissingUniform( int location ) const;
 	//! Logs a warning and caches the name.
 	void			logUniformWrongType( const std::string &name, GLenum uniformType, const std::string &userType ) const;
@@ -530,14 +654,16 @@ class CI_API GlslProg {
 	template<typename T>
 	bool			checkUniformType( GLenum uniformType, std::string &typeName ) const;
 #if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
-	//! Caches all active Uniform Blocks after linking.
-	void			cacheActiveUniformBlocks();
+	//! Caches all active Uniform Blocks on first access; deferred from construction since many programs never bind one.
+	void			cacheActiveUniformBlocks() const;
+	void			cacheActiveUniformBlocksImpl() const;
 	//! Returns a pointer to the Uniform Block that matches \a name. Returns nullptr if the attrib doesn't exist.
 	UniformBlock*	findUniformBlock( const std::string &name );
 #endif
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
-	//! Caches all active Transform Feedback Varyings after linking.
-	void			cacheActiveTransformFeedbackVaryings();
+	//! Completes the Transform Feedback Varyings cache on first access; deferred from construction like the uniform blocks.
+	void			cacheActiveTransformFeedbackVaryings() const;
+	void			cacheActiveTransformFeedbackVaryingsImpl() const;
 	//! Returns a pointer to the Transform Feedback Varyings that matches \a name. Returns nullptr if the attrib doesn't exist.
 	TransformFeedbackVaryings* findTransformFeedbackVaryings( const std::string &name );
 #endif
@@ -546,21 +672,40 @@ class CI_API GlslProg {
 	static std::string	cppTypeToGlslTypeName();
 	
 	GLuint									mHandle;
-	
+
 	std::vector<Attribute>						mAttributes;
 	std::vector<Uniform>						mUniforms;
-	mutable std::unique_ptr<UniformValueCache>	mUniformValueCache;
+	// indices into mAttributes / mUniforms keyed by name, to avoid linear string compares on the hot lookup path
+	std::unordered_map<std::string,uint32_t>	mAttribNameToIndex;
+	std::unordered_map<std::string,uint32_t>	mUniformNameToIndex;
+	// contiguous copy of each Uniform's name hash, padded to a multiple of 8 entries so the
+	// vectorized scan in findUniform( const UniformId & ) never reads past the end
+	std::vector<uint32_t>						mUniformNameHashes;
 #if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
-	std::vector<UniformBlock>				mUniformBlocks;
+	// mutable for the lazy caching, which may be hit concurrently from const accessors when a
+	// program is shared across recording threads; see cacheActiveUniformBlocks()
+	mutable std::vector<UniformBlock>				mUniformBlocks;
+	mutable std::unordered_map<std::string,uint32_t>	mUniformBlockNameToIndex;
+	mutable std::once_flag					mUniformBlocksCacheOnce;
 #endif
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
-	std::vector<TransformFeedbackVaryings>  mTransformFeedbackVaryings;
+	// the varying names are filled at construction (GL requires them before linking); the counts and
+	// types are completed lazily, see cacheActiveTransformFeedbackVaryings()
+	mutable std::vector<TransformFeedbackVaryings>  mTransformFeedbackVaryings;
+	mutable std::once_flag					mTransformFeedbackVaryingsCacheOnce;
 	GLenum									mTransformFeedbackFormat;
 #endif
 	
-	// enumerates the uniforms we've already logged as missing so that we don't flood the log with the same message
-	mutable std::set<std::string>			mLoggedUniformNames;
-	mutable std::set<int>					mLoggedUniformLocations;
+	// holds the uniform value cache; allocated lazily on first use so that programs which never have
+	// uniforms set through the CPU path don't carry the allocation. Published through an atomic
+	// pointer since the first uniform() call on a shared program may race between recording threads.
+	// Log deduplication lives in thread-local state inside the translation unit.
+	struct ShaderState;
+	ShaderState&	shaderState() const;
+
+	mutable std::atomic<ShaderState*>		mShaderState { nullptr };
+	// byte size the uniform value cache will need, computed in cacheActiveUniforms() for the lazy allocation
+	uint32_t								mUniformValueCacheSize = 0;
 	std::string								mLabel; // debug label
 	std::vector<fs::path>					mShaderPreprocessorIncludedFiles;
 
@@ -573,7 +718,15 @@ CI_API std::ostream& operator<<( std::ostream &os, const GlslProg &rhs );
 class CI_API GlslProgExc : public cinder::gl::Exception {
   public:
 	GlslProgExc()	{}
-	GlslProgExc( const std::string &description ) : cinder::gl::Exception( description )	{}
+	//! \a log is moved into shared storage, so copying or rethrowing the exception never copies the (potentially large) info log.
+	GlslProgExc( std::string log ) : mLog( std::make_shared<const std::string>( std::move( log ) ) )	{}
+
+	virtual const char* what() const throw() override	{ return mLog ? mLog->c_str() : ""; }
+
+  protected:
+	void	setLog( std::string log )	{ mLog = std::make_shared<const std::string>( std::move( log ) ); }
+
+	std::shared_ptr<const std::string>	mLog;
 };
 
 class CI_API GlslProgCompileExc : public GlslProgExc {
@@ -89,8 +89,18 @@ class CI_API ShaderPreprocessor {
 
 	//! Returns a Signal that the user can connect to in order to handle custom includes.
 	SignalIncludeHandler& getSignalInclude()	{ return mSignalInclude; }
-	
+
+	//! Sets whether parsed sources are cached and reused across ShaderPreprocessor instances. Cached results are
+	//! keyed on the source, defines, #version and search directories, and are revalidated against the last-write
+	//! times of all `#include`d files. Enabled by default. Parses using a custom include handler are never cached.
+	static void		setCachingEnabled( bool enable );
+	//! Returns whether parsed sources are cached and reused across ShaderPreprocessor instances. \default true.
+	static bool		isCachingEnabled();
+	//! Clears the cache of parsed sources.
+	static void		clearCache();
+
   private:
+	uint64_t		makeCacheKey( const std::string &source, const fs::path &sourcePath ) const;
 	void			parseDirectives( const std::string &source, const fs::path &sourcePath, std::string *directives, std::string *sourceBody, int *versionNumber, int *lineNumberStart );
 	std::string		parseTopLevel( const std::string &source, const fs::path &currentDirectory, int lineNumberStart, int versionNumber, std::set<fs::path> &includeTree );
 	std::string		parseRecursive( const fs::path &path, const fs::path &currentDirectory, int versionNumber, std::set<fs::path> &includeTree );
@@ -35,9 +35,15 @@ class CI_API Ubo : public BufferObj
   public:
 	static UboRef	create();
 	static UboRef	create( GLsizeiptr allocationSize, const void *data = nullptr, GLenum usage = GL_DYNAMIC_DRAW );
+#if defined( CINDER_GL_HAS_BUFFER_STORAGE )
+	//! Creates a Ubo of \a allocationSize bytes whose immutable store is persistently and coherently mapped; writes through getPersistentPtr() become visible to GL without further map/unmap calls. Returns null when the runtime lacks \c ARB_buffer_storage. Typically sub-ranges are bound via bindBufferRange() as a ring to avoid overwriting data still in flight.
+	static UboRef	createPersistent( GLsizeiptr allocationSize, GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT );
+#endif
 
 	//! Analogous to glBindBufferBase( getTarget(), \a index, getId() )
 	void	bindBufferBase( GLuint index );
+	//! Analogous to glBindBufferRange( getTarget(), \a index, getId(), \a offset, \a size )
+	void	bindBufferRange( GLuint index, GLintptr offset, GLsizeiptr size );
 
   protected:
 	Ubo();
@@ -162,10 +162,11 @@
 		#define CINDER_GL_HAS_FBO_MULTISAMPLING
 		#define CINDER_GL_HAS_UNIFORM_BLOCKS
 		#define CINDER_GL_HAS_MAP_BUFFER_RANGE
-		#define CINDER_GL_HAS_TRANSFORM_FEEDBACK 
+		#define CINDER_GL_HAS_TRANSFORM_FEEDBACK
 		#define CINDER_GL_HAS_RENDER_SNORM
 		#define CINDER_GL_HAS_REQUIRED_INTERNALFORMAT
 		#define CINDER_GL_HAS_SAMPLERS
+		#define CINDER_GL_HAS_PROGRAM_BINARY
 	#else 
 		// OpenGL ES 2
 		#if ! defined( CINDER_GL_ES_2_RPI )
@@ -210,6 +211,8 @@
 		#define CINDER_GL_HAS_COMPUTE_SHADER
 		#define CINDER_GL_HAS_DEBUG_OUTPUT
 		#define CINDER_GL_HAS_MULTI_DRAW_INDIRECT
+		#define CINDER_GL_HAS_PROGRAM_BINARY
+		#define CINDER_GL_HAS_BUFFER_STORAGE
 	#endif
 #endif
 
@@ -166,10 +166,29 @@ void* BufferObj::mapBufferRange( GLintptr offset, GLsizeiptr length, GLbitfield
 }
 #endif
 
+#if defined( CINDER_GL_HAS_BUFFER_STORAGE )
+void BufferObj::bufferStorage( GLsizeiptr size, const GLvoid *data, GLbitfield flags )
+{
+	ScopedBuffer bufferBind( mTarget, mId );
+	mSize = size;
+	glBufferStorage( mTarget, mSize, data, flags );
+}
+
+void* BufferObj::mapPersistent( GLbitfield access )
+{
+	ScopedBuffer bufferBind( mTarget, mId );
+	mPersistentPtr = reinterpret_cast<void*>( glMapBufferRange( mTarget, 0, mSize, access ) );
+	return mPersistentPtr;
+}
+#endif
+
 #if defined( CINDER_GL_HAS_MAP_BUFFER ) || defined( CINDER_GL_HAS_MAP_BUFFER_RANGE )
 void BufferObj::unmap() const
 {
 	ScopedBuffer bufferBind( mTarget, mId );
+#if defined( CINDER_GL_HAS_BUFFER_STORAGE )
+	mPersistentPtr = nullptr;
+#endif
     GLboolean result = glUnmapBuffer( mTarget );
     if ( GL_TRUE != result ) {
         //throw BufferFailedUnmapExc();
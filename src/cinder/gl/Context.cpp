@@ -729,6 +729,11 @@ void Context::bindBufferRange( GLenum target, GLuint index, const BufferObjRef &
 	glBindBufferRange( target, index, buffer->getId(), offset, size );
 }
 
+void Context::bindBufferRange( GLenum target, GLuint index, GLuint id, GLintptr offset, GLsizeiptr size )
+{
+	glBindBufferRange( target, index, id, offset, size );
+}
+
 #endif // ! defined( CINDER_GL_ES_2 )
 
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
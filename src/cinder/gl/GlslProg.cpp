@@ -33,7 +33,16 @@
 
 #include "glm/gtc/type_ptr.hpp"
 
+#include <algorithm>
+#include <fstream>
+#include <ostream>
+#include <sstream>
 #include <type_traits>
+#include <unordered_set>
+
+#if defined( __SSE2__ ) || defined( __AVX2__ ) || defined( __AVX512F__ )
+	#include <immintrin.h>
+#endif
 
 // For stoi and std:;to_string
 #if defined( CINDER_ANDROID )
@@ -53,52 +62,353 @@ static GlslProg::AttribSemanticMap	sDefaultAttribNameToSemanticMap;
 class UniformValueCache : cinder::Noncopyable {
   public:
 	UniformValueCache( uint32_t bufferSize )
-		: mBuffer( new uint8_t[bufferSize] ), mValidBytes( new bool[bufferSize] ), mBufferSize( bufferSize )
+		: mBuffer( new uint8_t[bufferSize] ), mValidWords( ( bufferSize + 63 ) / 64, 0 ), mBufferSize( bufferSize )
 	{
-		for( uint32_t b = 0; b < bufferSize; ++b )
-			mValidBytes[b] = false;
 	}
-	
+
 	// 'uniformByteOffset' expresses where the first element of an array is: example[0], although 'arrayIndex' may be >0
 	bool shouldBuffer( uint32_t uniformByteOffset, uint32_t typeSize, int arrayIndex, int indexCount, const void* valuePointer )
 	{
-		// are all the bytes in this range valid?
-		bool cacheValid = true;
-		for( uint32_t b = uniformByteOffset + arrayIndex * typeSize; b < uniformByteOffset + ( arrayIndex + indexCount ) * typeSize; ++b ) {
-			if( mValidBytes[b] == false ) {
-				cacheValid = false;
-				break;
-			}
-		}
-	
-		uint8_t* cachePtr = mBuffer.get() + uniformByteOffset + arrayIndex * typeSize;
-		
-		if( ! cacheValid ) { // if not, record it and cache it
-			for( uint32_t b = uniformByteOffset + arrayIndex * typeSize; b < uniformByteOffset + ( arrayIndex + indexCount ) * typeSize; ++b )
-				mValidBytes[b] = true;
+		const uint32_t firstByte = uniformByteOffset + arrayIndex * typeSize;
+		const uint32_t numBytes = typeSize * indexCount;
+		uint8_t* cachePtr = mBuffer.get() + firstByte;
 
-			memcpy( cachePtr, valuePointer, typeSize * indexCount );
+		if( ! isRangeValid( firstByte, numBytes ) ) { // not seen before; record it and cache it
+			markRangeValid( firstByte, numBytes );
+			memcpy( cachePtr, valuePointer, numBytes );
 			return true;
 		}
-		else {
-			// we've seen this byteOffset before; did its value change?
-			if( memcmp( cachePtr, valuePointer, typeSize * indexCount ) == 0 ) {
-				return false;
-			}
-			else { // yes? then cache the latest
-				memcpy( cachePtr, valuePointer, typeSize * indexCount );
-				return true;
-			}
+		// we've seen this byteOffset before; did its value change?
+		if( bytesEqual( cachePtr, valuePointer, numBytes ) ) {
+			return false;
+		}
+		else { // yes? then cache the latest
+			memcpy( cachePtr, valuePointer, numBytes );
+			return true;
 		}
 	}
-	
+
   private:
-	std::vector<uint32_t>			mCachedByteOffsets;
+	// returns true if every byte of [firstByte, firstByte + numBytes) has been cached before; one validity bit per byte
+	bool isRangeValid( uint32_t firstByte, uint32_t numBytes ) const
+	{
+		for( uint32_t b = firstByte, last = firstByte + numBytes; b < last; ) {
+			const uint32_t word = b >> 6;
+			const uint32_t lo = b & 63;
+			const uint32_t hi = std::min<uint32_t>( 64, lo + ( last - b ) );
+			const uint64_t mask = ( hi == 64 ? ~0ull : ( 1ull << hi ) - 1 ) & ~( ( 1ull << lo ) - 1 );
+			if( ( mValidWords[word] & mask ) != mask )
+				return false;
+			b += hi - lo;
+		}
+		return true;
+	}
+
+	void markRangeValid( uint32_t firstByte, uint32_t numBytes )
+	{
+		for( uint32_t b = firstByte, last = firstByte + numBytes; b < last; ) {
+			const uint32_t word = b >> 6;
+			const uint32_t lo = b & 63;
+			const uint32_t hi = std::min<uint32_t>( 64, lo + ( last - b ) );
+			mValidWords[word] |= ( hi == 64 ? ~0ull : ( 1ull << hi ) - 1 ) & ~( ( 1ull << lo ) - 1 );
+			b += hi - lo;
+		}
+	}
+
+	// wide compare of the cached bytes against the incoming value; the unchanged-value case is the common one.
+	// mat4 arrays (a mat4 per bone in skinning paths) retire at a full matrix per compare on AVX-512 targets
+	static bool bytesEqual( const uint8_t* cachePtr, const void* valuePointer, uint32_t numBytes )
+	{
+		const uint8_t* src = reinterpret_cast<const uint8_t*>( valuePointer );
+#if defined( __AVX512F__ )
+		while( numBytes >= 64 ) {
+			const __m512i a = _mm512_loadu_si512( reinterpret_cast<const void*>( cachePtr ) );
+			const __m512i b = _mm512_loadu_si512( reinterpret_cast<const void*>( src ) );
+			if( _mm512_cmpeq_epi32_mask( a, b ) != (__mmask16)0xFFFF )
+				return false;
+			cachePtr += 64; src += 64; numBytes -= 64;
+		}
+#endif
+#if defined( __AVX2__ )
+		while( numBytes >= 32 ) {
+			const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( cachePtr ) );
+			const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( src ) );
+			if( _mm256_movemask_epi8( _mm256_cmpeq_epi32( a, b ) ) != (int)0xFFFFFFFF )
+				return false;
+			cachePtr += 32; src += 32; numBytes -= 32;
+		}
+#endif
+#if defined( __SSE2__ )
+		while( numBytes >= 16 ) {
+			const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( cachePtr ) );
+			const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src ) );
+			if( _mm_movemask_epi8( _mm_cmpeq_epi32( a, b ) ) != 0xFFFF )
+				return false;
+			cachePtr += 16; src += 16; numBytes -= 16;
+		}
+#endif
+		return memcmp( cachePtr, src, numBytes ) == 0;
+	}
+
 	std::unique_ptr<uint8_t[]>		mBuffer;
-	std::unique_ptr<bool[]>			mValidBytes;
+	std::vector<uint64_t>			mValidWords; // one validity bit per byte of mBuffer
 	uint32_t						mBufferSize;
 };
-	
+
+// Lazily allocated per-program state; see GlslProg::shaderState()
+struct GlslProg::ShaderState {
+	std::unique_ptr<UniformValueCache>	mUniformValueCache;
+};
+
+namespace {
+
+// Deduplicates the missing-uniform / wrong-type warnings. The state is thread-local because logging
+// happens from const methods which may run concurrently when a program is shared across recording
+// threads; per-thread sets keep this race-free without locking or coherence traffic. Keys mix the
+// program address with the uniform's name hash (or location), so at worst a program recycled at the
+// same address has a warning suppressed.
+// A 128-bit bloom filter fronts the hash set so that the common "already logged" case is two bit tests.
+struct ThreadLogDedup {
+	//! Returns whether \a key had been seen before on this thread, marking it seen either way.
+	bool testAndSet( uint64_t key )
+	{
+		const uint64_t bit0 = 1ull << ( key & 63 );
+		const uint64_t bit1 = 1ull << ( ( key >> 6 ) & 63 );
+		if( ( mBloom[0] & bit0 ) && ( mBloom[1] & bit1 ) ) {
+			if( mKeys.count( key ) )
+				return true;
+		}
+		mBloom[0] |= bit0;
+		mBloom[1] |= bit1;
+		mKeys.insert( key );
+		return false;
+	}
+
+	uint64_t					mBloom[2] = { 0, 0 };
+	std::unordered_set<uint64_t>	mKeys;
+};
+
+ThreadLogDedup& threadLogDedup()
+{
+	static thread_local ThreadLogDedup sDedup;
+	return sDedup;
+}
+
+uint64_t logDedupKey( const GlslProg *prog, uint32_t hash )
+{
+	return ( (uint64_t)reinterpret_cast<uintptr_t>( prog ) * 0x9e3779b97f4a7c15ull ) ^ hash;
+}
+
+// salt keeping location keys from colliding with name-hash keys for the same program
+const uint64_t kLogDedupLocationSalt = 0x517cc1b727220a95ull;
+
+} // anonymous namespace
+
+GlslProg::ShaderState& GlslProg::shaderState() const
+{
+	ShaderState *state = mShaderState.load( std::memory_order_acquire );
+	if( ! state ) {
+		std::unique_ptr<ShaderState> fresh( new ShaderState() );
+#if ! defined( DISABLE_UNIFORM_CACHING )
+		if( mUniformValueCacheSize )
+			fresh->mUniformValueCache = std::unique_ptr<UniformValueCache>( new UniformValueCache( mUniformValueCacheSize ) );
+#endif
+		// first-touch may race between recording threads sharing the program; whoever publishes
+		// first wins and the loser's allocation is discarded
+		ShaderState *expected = nullptr;
+		if( mShaderState.compare_exchange_strong( expected, fresh.get(), std::memory_order_acq_rel ) )
+			state = fresh.release();
+		else
+			state = expected;
+	}
+	return *state;
+}
+
+#if defined( CINDER_GL_HAS_PROGRAM_BINARY )
+namespace {
+
+uint64_t fnv1a64( const std::string &str, uint64_t hash = 14695981039346656037ull )
+{
+	for( const char c : str )
+		hash = ( hash ^ (uint64_t)(uint8_t)c ) * 1099511628211ull;
+	return hash;
+}
+
+// Builds the cache key for a program binary: all shader sources and preprocessor settings, plus the
+// driver strings since program binaries are driver- (and often driver-version-) specific.
+std::string binaryCacheFileName( const GlslProg::Format &format )
+{
+	uint64_t hash = fnv1a64( format.getVertex() );
+	hash = fnv1a64( format.getFragment(), hash );
+#if defined( CINDER_GL_HAS_GEOM_SHADER )
+	hash = fnv1a64( format.getGeometry(), hash );
+#endif
+#if defined( CINDER_GL_HAS_TESS_SHADER )
+	hash = fnv1a64( format.getTessellationCtrl(), hash );
+	hash = fnv1a64( format.getTessellationEval(), hash );
+#endif
+#if defined( CINDER_GL_HAS_COMPUTE_SHADER )
+	hash = fnv1a64( format.getCompute(), hash );
+#endif
+	for( const auto &define : format.getDefines() ) {
+		hash = fnv1a64( define.first, hash );
+		hash = fnv1a64( define.second, hash );
+	}
+	hash = fnv1a64( std::to_string( format.getVersion() ), hash );
+
+	// pre-link state carried by the Format is baked into the binary, so it must participate in the
+	// key as well: user attrib locations, frag data bindings and the transform feedback configuration
+	for( const auto &attrib : format.getAttributes() ) {
+		if( attrib.getLocation() > -1 ) {
+			hash = fnv1a64( attrib.getName(), hash );
+			hash = fnv1a64( std::to_string( attrib.getLocation() ), hash );
+			hash = fnv1a64( std::to_string( (int)attrib.getSemantic() ), hash );
+		}
+	}
+#if ! defined( CINDER_GL_ES )
+	for( const auto &fragDataLocation : format.getFragDataLocations() ) {
+		hash = fnv1a64( fragDataLocation.first, hash );
+		hash = fnv1a64( std::to_string( fragDataLocation.second ), hash );
+	}
+#endif
+#if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
+	for( const auto &varying : format.getVaryings() )
+		hash = fnv1a64( varying, hash );
+	hash = fnv1a64( std::to_string( (int)format.getTransformFormat() ), hash );
+#endif
+
+	for( const GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION } ) {
+		const char *str = reinterpret_cast<const char*>( glGetString( name ) );
+		if( str )
+			hash = fnv1a64( str, hash );
+	}
+
+	char hex[17];
+	snprintf( hex, sizeof( hex ), "%016llx", (unsigned long long)hash );
+	return std::string( hex ) + ".bin";
+}
+
+} // anonymous namespace
+#endif // defined( CINDER_GL_HAS_PROGRAM_BINARY )
+
+namespace {
+
+// Compressed uniform type tags. Each glUniform-settable GLSL type collapses to one tag (samplers count
+// as signed ints), precomputed when the uniform is cached, so that per-call type validation is a
+// comparison of two small integers rather than a switch over the GLenum.
+enum : uint8_t {
+	UNIFORM_TYPE_TAG_UNKNOWN = 0,
+	UNIFORM_TYPE_TAG_BOOL, UNIFORM_TYPE_TAG_BVEC2, UNIFORM_TYPE_TAG_BVEC3, UNIFORM_TYPE_TAG_BVEC4,
+	UNIFORM_TYPE_TAG_INT, UNIFORM_TYPE_TAG_IVEC2, UNIFORM_TYPE_TAG_IVEC3, UNIFORM_TYPE_TAG_IVEC4,
+	UNIFORM_TYPE_TAG_UINT, UNIFORM_TYPE_TAG_UVEC2, UNIFORM_TYPE_TAG_UVEC3, UNIFORM_TYPE_TAG_UVEC4,
+	UNIFORM_TYPE_TAG_FLOAT, UNIFORM_TYPE_TAG_VEC2, UNIFORM_TYPE_TAG_VEC3, UNIFORM_TYPE_TAG_VEC4,
+	UNIFORM_TYPE_TAG_MAT2, UNIFORM_TYPE_TAG_MAT3, UNIFORM_TYPE_TAG_MAT4
+};
+
+// Mirrors the cases of GlslProg::checkUniformType(), which remains the authority on mismatches.
+uint8_t uniformTypeTag( GLenum type )
+{
+	switch( type ) {
+		// bool
+		case GL_BOOL:		return UNIFORM_TYPE_TAG_BOOL;
+		case GL_BOOL_VEC2:	return UNIFORM_TYPE_TAG_BVEC2;
+		case GL_BOOL_VEC3:	return UNIFORM_TYPE_TAG_BVEC3;
+		case GL_BOOL_VEC4:	return UNIFORM_TYPE_TAG_BVEC4;
+		// signed int
+		case GL_INT:		return UNIFORM_TYPE_TAG_INT;
+		case GL_INT_VEC2:	return UNIFORM_TYPE_TAG_IVEC2;
+		case GL_INT_VEC3:	return UNIFORM_TYPE_TAG_IVEC3;
+		case GL_INT_VEC4:	return UNIFORM_TYPE_TAG_IVEC4;
+		case GL_SAMPLER_2D:	return UNIFORM_TYPE_TAG_INT;
+#if defined( CINDER_ANDROID )
+		case GL_SAMPLER_EXTERNAL_OES: return UNIFORM_TYPE_TAG_INT;
+#endif
+		// unsigned int
+		case GL_UNSIGNED_INT: return UNIFORM_TYPE_TAG_UINT;
+#if ! defined( CINDER_GL_ES )
+		case GL_SAMPLER_1D:						return UNIFORM_TYPE_TAG_INT;
+		case GL_SAMPLER_BUFFER_EXT:				return UNIFORM_TYPE_TAG_INT;
+		case GL_UNSIGNED_INT_SAMPLER_BUFFER:	return UNIFORM_TYPE_TAG_INT;
+		case GL_SAMPLER_2D_RECT:				return UNIFORM_TYPE_TAG_INT;
+		case GL_INT_SAMPLER_2D_RECT:			return UNIFORM_TYPE_TAG_INT;
+		case GL_UNSIGNED_INT_SAMPLER_2D_RECT:	return UNIFORM_TYPE_TAG_INT;
+#endif
+#if ! defined( CINDER_GL_ES_2 )
+		case GL_SAMPLER_3D:						return UNIFORM_TYPE_TAG_INT;
+		case GL_UNSIGNED_INT_VEC2:				return UNIFORM_TYPE_TAG_UVEC2;
+		case GL_UNSIGNED_INT_VEC3:				return UNIFORM_TYPE_TAG_UVEC3;
+		case GL_UNSIGNED_INT_VEC4:				return UNIFORM_TYPE_TAG_UVEC4;
+		case GL_SAMPLER_2D_SHADOW:				return UNIFORM_TYPE_TAG_INT;
+		case GL_SAMPLER_2D_ARRAY:				return UNIFORM_TYPE_TAG_INT;
+		case GL_SAMPLER_2D_ARRAY_SHADOW:		return UNIFORM_TYPE_TAG_INT;
+		case GL_SAMPLER_CUBE_SHADOW:			return UNIFORM_TYPE_TAG_INT;
+		case GL_INT_SAMPLER_2D:					return UNIFORM_TYPE_TAG_INT;
+		case GL_INT_SAMPLER_3D:					return UNIFORM_TYPE_TAG_INT;
+		case GL_INT_SAMPLER_CUBE:				return UNIFORM_TYPE_TAG_INT;
+		case GL_INT_SAMPLER_2D_ARRAY:			return UNIFORM_TYPE_TAG_INT;
+		case GL_UNSIGNED_INT_SAMPLER_2D:		return UNIFORM_TYPE_TAG_INT;
+		case GL_UNSIGNED_INT_SAMPLER_3D:		return UNIFORM_TYPE_TAG_INT;
+		case GL_UNSIGNED_INT_SAMPLER_CUBE:		return UNIFORM_TYPE_TAG_INT;
+		case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY:	return UNIFORM_TYPE_TAG_INT;
+#else
+	#if defined( CINDER_ANDROID ) || defined( CINDER_LINUX )
+	  #if defined( CINDER_GL_HAS_SHADOW_SAMPLERS )
+		case GL_SAMPLER_2D_SHADOW_EXT: return UNIFORM_TYPE_TAG_INT;
+	  #endif
+	#else
+		case GL_SAMPLER_2D_SHADOW_EXT: return UNIFORM_TYPE_TAG_INT;
+	#endif
+#endif
+		case GL_SAMPLER_CUBE: return UNIFORM_TYPE_TAG_INT;
+		// float
+		case GL_FLOAT:		return UNIFORM_TYPE_TAG_FLOAT;
+		case GL_FLOAT_VEC2:	return UNIFORM_TYPE_TAG_VEC2;
+		case GL_FLOAT_VEC3:	return UNIFORM_TYPE_TAG_VEC3;
+		case GL_FLOAT_VEC4:	return UNIFORM_TYPE_TAG_VEC4;
+		// matrix
+		case GL_FLOAT_MAT2:	return UNIFORM_TYPE_TAG_MAT2;
+		case GL_FLOAT_MAT3:	return UNIFORM_TYPE_TAG_MAT3;
+		case GL_FLOAT_MAT4:	return UNIFORM_TYPE_TAG_MAT4;
+		default:			return UNIFORM_TYPE_TAG_UNKNOWN;
+	}
+}
+
+template<typename T>
+constexpr uint8_t cppUniformTypeTag()
+{
+	return std::is_same<T,bool>::value			? UNIFORM_TYPE_TAG_BOOL
+		: std::is_same<T,glm::bvec2>::value		? UNIFORM_TYPE_TAG_BVEC2
+		: std::is_same<T,glm::bvec3>::value		? UNIFORM_TYPE_TAG_BVEC3
+		: std::is_same<T,glm::bvec4>::value		? UNIFORM_TYPE_TAG_BVEC4
+		: std::is_same<T,int32_t>::value		? UNIFORM_TYPE_TAG_INT
+		: std::is_same<T,glm::ivec2>::value		? UNIFORM_TYPE_TAG_IVEC2
+		: std::is_same<T,glm::ivec3>::value		? UNIFORM_TYPE_TAG_IVEC3
+		: std::is_same<T,glm::ivec4>::value		? UNIFORM_TYPE_TAG_IVEC4
+		: std::is_same<T,uint32_t>::value		? UNIFORM_TYPE_TAG_UINT
+		: std::is_same<T,glm::uvec2>::value		? UNIFORM_TYPE_TAG_UVEC2
+		: std::is_same<T,glm::uvec3>::value		? UNIFORM_TYPE_TAG_UVEC3
+		: std::is_same<T,glm::uvec4>::value		? UNIFORM_TYPE_TAG_UVEC4
+		: std::is_same<T,float>::value			? UNIFORM_TYPE_TAG_FLOAT
+		: std::is_same<T,glm::vec2>::value		? UNIFORM_TYPE_TAG_VEC2
+		: std::is_same<T,glm::vec3>::value		? UNIFORM_TYPE_TAG_VEC3
+		: std::is_same<T,glm::vec4>::value		? UNIFORM_TYPE_TAG_VEC4
+		: std::is_same<T,glm::mat2>::value		? UNIFORM_TYPE_TAG_MAT2
+		: std::is_same<T,glm::mat3>::value		? UNIFORM_TYPE_TAG_MAT3
+		: std::is_same<T,glm::mat4>::value		? UNIFORM_TYPE_TAG_MAT4
+		: UNIFORM_TYPE_TAG_UNKNOWN;
+}
+
+// The fast path accepts exactly matching tags, plus int32_t for GL_BOOL uniforms; anything else is
+// re-checked against the full GLenum switch before being reported as a mismatch.
+template<typename T>
+inline bool uniformTypeTagMatches( uint8_t uniformTag )
+{
+	return uniformTag == cppUniformTypeTag<T>()
+		|| ( uniformTag == UNIFORM_TYPE_TAG_BOOL && cppUniformTypeTag<T>() == UNIFORM_TYPE_TAG_INT );
+}
+
+} // anonymous namespace
+
 //////////////////////////////////////////////////////////////////////////
 // GlslProg::Attribute
 	
@@ -264,12 +574,12 @@ GlslProg::Format& GlslProg::Format::compute( const string &computeShader )
 
 #endif // defined( CINDER_GL_HAS_COMPUTE_SHADER )
 
-void GlslProg::Format::setShaderSource( const DataSourceRef &dataSource, string *shaderSourceDest, fs::path *shaderPathDest )
+void GlslProg::Format::setShaderSource( const DataSourceRef &dataSource, ShaderSourceRef *shaderSourceDest, fs::path *shaderPathDest )
 {
 	if( dataSource ) {
 		auto buffer = dataSource->getBuffer();
 		const char *data = static_cast<const char *>( buffer->getData() );
-		*shaderSourceDest = string( data, data + buffer->getSize() );
+		*shaderSourceDest = make_shared<const string>( data, data + buffer->getSize() );
 
 		if( dataSource->isFilePath() )
 			*shaderPathDest = dataSource->getFilePath();
@@ -277,17 +587,23 @@ void GlslProg::Format::setShaderSource( const DataSourceRef &dataSource, string
 			shaderPathDest->clear();
 	}
 	else {
-		shaderSourceDest->clear();
+		shaderSourceDest->reset();
 		shaderPathDest->clear();
 	}
 }
 
-void GlslProg::Format::setShaderSource( const std::string &source, std::string *shaderSourceDest, fs::path *shaderPathDest )
+void GlslProg::Format::setShaderSource( std::string source, ShaderSourceRef *shaderSourceDest, fs::path *shaderPathDest )
 {
-	*shaderSourceDest = source;
+	*shaderSourceDest = make_shared<const string>( move( source ) );
 	shaderPathDest->clear();
 }
 
+const std::string& GlslProg::Format::getEmptyString()
+{
+	static const std::string sEmpty;
+	return sEmpty;
+}
+
 GlslProg::Format& GlslProg::Format::attrib( geom::Attrib semantic, const std::string &attribName )
 {
 	for( auto& attrib : mAttributes ) {
@@ -433,7 +749,12 @@ GlslProg::Format& GlslProg::Format::attribLocation( geom::Attrib attribSemantic,
 #if ! defined( CINDER_GL_ES )
 GlslProg::Format& GlslProg::Format::fragDataLocation( GLuint colorNumber, const std::string &name )
 {
-	mFragDataLocations[name] = colorNumber;
+	auto existing = find_if( mFragDataLocations.begin(), mFragDataLocations.end(),
+		[&name]( const pair<string,GLuint> &fragDataLocation ) { return fragDataLocation.first == name; } );
+	if( existing != mFragDataLocations.end() )
+		existing->second = colorNumber;
+	else
+		mFragDataLocations.push_back( { name, colorNumber } );
 	return *this;
 }
 #endif
@@ -479,19 +800,32 @@ GlslProg::~GlslProg()
 	if( mHandle ) {
 		glDeleteProgram( (GLuint)mHandle );
 	}
+
+	delete mShaderState.load( std::memory_order_acquire );
 }
 
 //////////////////////////////////////////////////////////////////////////
 // GlslProg
 
 GlslProg::GlslProg( const Format &format )
-	: mUniformValueCache( nullptr )
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
-		, mTransformFeedbackFormat( -1 )
+	: mTransformFeedbackFormat( -1 )
 #endif
 {
 	mHandle = glCreateProgram();
 
+	auto &userDefinedAttribs = format.getAttributes();
+
+#if defined( CINDER_GL_HAS_PROGRAM_BINARY )
+	fs::path binaryCachePath;
+	if( ! format.getBinaryCacheDirectory().empty() )
+		binaryCachePath = format.getBinaryCacheDirectory() / binaryCacheFileName( format );
+
+	// a cached binary carries the full post-link state, including attrib / frag data bindings,
+	// so on a hit we skip straight to caching the active attribs & uniforms
+	if( binaryCachePath.empty() || ! loadProgramBinary( binaryCachePath ) ) {
+#endif
+
 	GLuint vertexHandle = loadShader( format.getVertex(), format.mVertexShaderPath, GL_VERTEX_SHADER, format.getPreprocessor() );
 	GLuint fragmentHandle = loadShader( format.getFragment(), format.mFragmentShaderPath, GL_FRAGMENT_SHADER, format.getPreprocessor() );
 #if defined( CINDER_GL_HAS_GEOM_SHADER )
@@ -505,8 +839,6 @@ GlslProg::GlslProg( const Format &format )
 	GLuint computeHandle = loadShader( format.getCompute(), format.mComputeShaderPath, GL_COMPUTE_SHADER, format.getPreprocessor() );
 #endif
 
-	auto &userDefinedAttribs = format.getAttributes();
-	
 	bool foundPositionSemantic = false;
 	// if the user has provided a location make sure to bind that location before we go further
 	for( auto &attrib : userDefinedAttribs ) {
@@ -564,6 +896,15 @@ GlslProg::GlslProg( const Format &format )
 		glBindFragDataLocation( mHandle, fragDataLocation.second, fragDataLocation.first.c_str() );
 #endif
 
+#if defined( CINDER_GL_HAS_PROGRAM_BINARY )
+	if( ! binaryCachePath.empty() ) {
+#if ! defined( CINDER_GL_ES )
+		if( glProgramParameteri ) // null when the driver predates GL_ARB_get_program_binary
+#endif
+			glProgramParameteri( mHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+	}
+#endif
+
 	link();
 
 	// Detach all shaders, allowing GL to free the associated memory
@@ -583,20 +924,31 @@ GlslProg::GlslProg( const Format &format )
 #endif
 #if defined( CINDER_GL_HAS_COMPUTE_SHADER )
 	if( computeHandle )
-		glDetachShader( mHandle, computeHandle );	
+		glDetachShader( mHandle, computeHandle );
 #endif
-	
-	cacheActiveAttribs();
-	cacheActiveUniforms();
-#if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
-	if( ! format.getVaryings().empty() ) {
-		cacheActiveTransformFeedbackVaryings();
+
+#if defined( CINDER_GL_HAS_PROGRAM_BINARY )
+	if( ! binaryCachePath.empty() )
+		saveProgramBinary( binaryCachePath );
+	} // ! loadProgramBinary( binaryCachePath )
+  #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
+	else if( ! format.getVaryings().empty() && format.getTransformFormat() > 0 ) {
+		// a restored binary carries the feedback configuration GL-side, but the CPU-side mirror
+		// (varying names and format) still needs to be populated from the Format
+		auto & userVaryings = format.getVaryings();
+		mTransformFeedbackVaryings.resize( userVaryings.size() );
+		for( size_t i = 0; i < userVaryings.size(); ++i )
+			mTransformFeedbackVaryings[i].mName = userVaryings[i];
+		mTransformFeedbackFormat = format.getTransformFormat();
 	}
-#endif
-#if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
-	cacheActiveUniformBlocks();
+  #endif
 #endif
 
+	cacheActiveAttribs();
+	cacheActiveUniforms();
+	// uniform blocks and transform feedback varyings are cached lazily on first access; many
+	// programs never touch either, and the associated glGetActive* round-trips aren't free
+
 	auto & userDefinedUniforms = format.getUniforms();
 	// check if the user thinks there's a uniform that isn't active
 	for( auto &userUniform : userDefinedUniforms ) {
@@ -612,8 +964,8 @@ GlslProg::GlslProg( const Format &format )
 			}
 		}
 		if( ! foundUserDefined ) {
+			isUniformLogged( userUniform.mName ); // record it so the miss isn't logged again per-frame
 			CI_LOG_W( "Unknown uniform: \"" << userUniform.mName << "\"" );
-			mLoggedUniformNames.insert( userUniform.mName );
 		}
 	}
 	// make sure we get all of the semantic info correct from the user
@@ -770,7 +1122,80 @@ void GlslProg::link()
 		throw GlslProgLinkExc( log );
 	}
 }
-	
+
+#if defined( CINDER_GL_HAS_PROGRAM_BINARY )
+
+bool GlslProg::loadProgramBinary( const fs::path &binaryPath )
+{
+#if ! defined( CINDER_GL_ES )
+	if( ! glProgramBinary ) // driver predates GL_ARB_get_program_binary
+		return false;
+#endif
+
+	std::ifstream in( binaryPath.string().c_str(), std::ios::binary );
+	if( ! in )
+		return false;
+
+	GLenum binaryFormat;
+	in.read( reinterpret_cast<char*>( &binaryFormat ), sizeof( binaryFormat ) );
+	if( ! in )
+		return false;
+
+	std::vector<char> binary( ( std::istreambuf_iterator<char>( in ) ), std::istreambuf_iterator<char>() );
+	if( binary.empty() )
+		return false;
+
+	glProgramBinary( mHandle, binaryFormat, binary.data(), (GLsizei)binary.size() );
+
+	// rejected binaries (driver update, differing context) simply fail to link and we fall back to source
+	GLint status = GL_FALSE;
+	glGetProgramiv( mHandle, GL_LINK_STATUS, &status );
+	return status == GL_TRUE;
+}
+
+void GlslProg::saveProgramBinary( const fs::path &binaryPath ) const
+{
+#if ! defined( CINDER_GL_ES )
+	if( ! glGetProgramBinary )
+		return;
+#endif
+
+	GLint binaryLength = 0;
+	glGetProgramiv( mHandle, GL_PROGRAM_BINARY_LENGTH, &binaryLength );
+	if( binaryLength <= 0 )
+		return;
+
+	std::vector<char> binary( binaryLength );
+	GLenum binaryFormat = 0;
+	GLsizei binaryWritten = 0;
+	glGetProgramBinary( mHandle, binaryLength, &binaryWritten, &binaryFormat, binary.data() );
+	if( binaryWritten <= 0 )
+		return;
+
+	try {
+		if( ! fs::exists( binaryPath.parent_path() ) )
+			fs::create_directories( binaryPath.parent_path() );
+
+		// write to a temporary and rename so another process never observes a partial file
+		fs::path tempPath = binaryPath;
+		tempPath += ".tmp";
+		{
+			std::ofstream out( tempPath.string().c_str(), std::ios::binary | std::ios::trunc );
+			if( ! out )
+				return;
+			out.write( reinterpret_cast<const char*>( &binaryFormat ), sizeof( binaryFormat ) );
+			out.write( binary.data(), binaryWritten );
+		}
+		fs::remove( binaryPath );
+		fs::rename( tempPath, binaryPath );
+	}
+	catch( const std::exception &exc ) {
+		CI_LOG_W( "Failed to write program binary to \"" << binaryPath << "\": " << exc.what() );
+	}
+}
+
+#endif // defined( CINDER_GL_HAS_PROGRAM_BINARY )
+
 void GlslProg::cacheActiveAttribs()
 {
 	GLint numActiveAttrs = 0;
@@ -794,10 +1219,12 @@ void GlslProg::cacheActiveAttribs()
 		
 		Attribute attrib;
 		attrib.mName		= name;
+		attrib.mNameHash	= detail::constHash( name );
 		attrib.mLoc			= loc;
-		attrib.mCount		= count;
+		attrib.mCount		= (uint16_t)count;
 		attrib.mType		= type;
 		attrib.mSemantic	= attributeSemantic;
+		mAttribNameToIndex[attrib.mName] = (uint32_t)mAttributes.size();
 		mAttributes.push_back( attrib );
 	}
 }
@@ -810,15 +1237,35 @@ void GlslProg::cacheActiveUniforms()
 	auto & semanticNameMap = getDefaultUniformNameToSemanticMap();
 	
 	uint32_t uniformValueCacheSize = 0;
-	
+	mUniforms.reserve( numActiveUniforms );
+
 	for( GLint i = 0; i < numActiveUniforms; ++i ) {
 		char name[512];
 		GLsizei nameLength;
 		GLint count;
 		GLenum type;
-		
-		glGetActiveUniform( mHandle, (GLuint)i, 511, &nameLength, &count, &type, name );
-		auto loc = glGetUniformLocation( mHandle, name );
+		GLint loc;
+
+#if ! defined( CINDER_GL_ES )
+		if( glGetProgramResourceiv ) { // GL 4.3 / ARB_program_interface_query
+			// one batched query covers what glGetActiveUniform() + glGetUniformLocation() used to take,
+			// and GL_BLOCK_INDEX rejects uniform block members before their names are even fetched
+			static const GLenum props[] = { GL_BLOCK_INDEX, GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE };
+			GLint values[4] = {};
+			glGetProgramResourceiv( mHandle, GL_UNIFORM, (GLuint)i, 4, props, 4, nullptr, values );
+			if( values[0] != -1 ) // part of a uniform block; cached with the block
+				continue;
+			loc = values[1];
+			type = (GLenum)values[2];
+			count = values[3];
+			glGetProgramResourceName( mHandle, GL_UNIFORM, (GLuint)i, 511, &nameLength, name );
+		}
+		else
+#endif
+		{
+			glGetActiveUniform( mHandle, (GLuint)i, 511, &nameLength, &count, &type, name );
+			loc = glGetUniformLocation( mHandle, name );
+		}
 		// This may be a part of a uniform block, in that case it will be counted as
 		// an active uniform but have a location of -1. Disregard as we'll catch it
 		// when we cache the uniform block.
@@ -832,26 +1279,38 @@ void GlslProg::cacheActiveUniforms()
 			
 			Uniform uniform;
 			uniform.mName			= name;
+			uniform.mNameHash		= detail::constHash( name );
 			uniform.mLoc			= loc;
-			uniform.mIndex			= i;
-			uniform.mCount			= count;
+			uniform.mIndex			= (int16_t)i;
+			uniform.mCount			= (uint16_t)count;
 			uniform.mType			= type;
-			uniform.mTypeSize		= gl::typeToBytes( type );
+			uniform.mTypeTag		= uniformTypeTag( type );
+			uniform.mTypeSize		= (uint16_t)gl::typeToBytes( type );
 			uniform.mSemantic		= uniformSemantic;
 			uniform.mBytePointer	= uniformValueCacheSize;
 			uniformValueCacheSize  += uniform.mTypeSize * count;
+			mUniformNameToIndex[uniform.mName] = (uint32_t)mUniforms.size();
+			mUniformNameHashes.push_back( uniform.mNameHash );
 			mUniforms.push_back( uniform );
 		}
 	}
-	
-#if ! defined( DISABLE_UNIFORM_CACHING )
-	if( numActiveUniforms )
-		mUniformValueCache = unique_ptr<UniformValueCache>( new UniformValueCache( uniformValueCacheSize ) );
-#endif
+
+	// pad to a full 8-lane group; see findUniform( const UniformId & )
+	mUniformNameHashes.resize( ( mUniforms.size() + 7 ) & ~size_t( 7 ), 0 );
+
+	// the cache itself is allocated lazily with the rest of the ShaderState; see shaderState()
+	mUniformValueCacheSize = uniformValueCacheSize;
 }
 
 #if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
-void GlslProg::cacheActiveUniformBlocks()
+void GlslProg::cacheActiveUniformBlocks() const
+{
+	// const accessors may land here concurrently when a program is shared across recording threads;
+	// call_once runs the fill exactly once and publishes the finished containers to late arrivals
+	std::call_once( mUniformBlocksCacheOnce, &GlslProg::cacheActiveUniformBlocksImpl, this );
+}
+
+void GlslProg::cacheActiveUniformBlocksImpl() const
 {
 	GLint numActiveUniformBlocks = 0;
 	glGetProgramiv( mHandle, GL_ACTIVE_UNIFORM_BLOCKS, &numActiveUniformBlocks );
@@ -900,9 +1359,10 @@ void GlslProg::cacheActiveUniformBlocks()
 			
 			Uniform uniform;
 			uniform.mName		= name;
+			uniform.mNameHash	= detail::constHash( name );
 			uniform.mLoc		= -1;
-			uniform.mIndex      = index;
-			uniform.mCount		= count;
+			uniform.mIndex      = (int16_t)index;
+			uniform.mCount		= (uint16_t)count;
 			uniform.mType		= type;
 			uniform.mSemantic	= uniformSemantic;
 			unSignedIndices[j++]= index;
@@ -910,29 +1370,27 @@ void GlslProg::cacheActiveUniformBlocks()
 			uniformBlock.mActiveUniforms.push_back( uniform );
 		}
 
-		std::vector<GLint> uniformOffset( numActiveUniforms );
+		auto &info = uniformBlock.mActiveUniformInfo;
+		info.mOffsets.resize( numActiveUniforms );
 		glGetActiveUniformsiv( mHandle,
 							  numActiveUniforms,
 							  unSignedIndices.data(),
 							  GL_UNIFORM_OFFSET,
-							  uniformOffset.data() );
-		std::vector<GLint> uniformArrayStride( numActiveUniforms );
+							  info.mOffsets.data() );
+		info.mArrayStrides.resize( numActiveUniforms );
 		glGetActiveUniformsiv( mHandle,
 							  numActiveUniforms,
 							  unSignedIndices.data(),
 							  GL_UNIFORM_ARRAY_STRIDE,
-							  uniformArrayStride.data() );
-		std::vector<GLint> uniformMatrixStride( numActiveUniforms );
+							  info.mArrayStrides.data() );
+		info.mMatrixStrides.resize( numActiveUniforms );
 		glGetActiveUniformsiv( mHandle,
 							  numActiveUniforms,
 							  unSignedIndices.data(),
 							  GL_UNIFORM_MATRIX_STRIDE,
-							  uniformMatrixStride.data() );
-		
-		uniformBlock.mActiveUniformInfo.insert( make_pair( GL_UNIFORM_OFFSET, uniformOffset ) );
-		uniformBlock.mActiveUniformInfo.insert( make_pair( GL_UNIFORM_ARRAY_STRIDE, uniformArrayStride ) );
-		uniformBlock.mActiveUniformInfo.insert( make_pair( GL_UNIFORM_MATRIX_STRIDE, uniformMatrixStride ) );
-		
+							  info.mMatrixStrides.data() );
+
+		mUniformBlockNameToIndex[uniformBlock.mName] = (uint32_t)mUniformBlocks.size();
 		mUniformBlocks.push_back( uniformBlock );
 	}
 }
@@ -940,27 +1398,34 @@ void GlslProg::cacheActiveUniformBlocks()
 #endif // defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
 
-void GlslProg::cacheActiveTransformFeedbackVaryings()
+void GlslProg::cacheActiveTransformFeedbackVaryings() const
+{
+	// guarded like the uniform blocks above; see cacheActiveUniformBlocks()
+	std::call_once( mTransformFeedbackVaryingsCacheOnce, &GlslProg::cacheActiveTransformFeedbackVaryingsImpl, this );
+}
+
+void GlslProg::cacheActiveTransformFeedbackVaryingsImpl() const
 {
 	GLint numActiveTransformFeedbackVaryings;
 	glGetProgramiv( mHandle, GL_TRANSFORM_FEEDBACK_VARYINGS, &numActiveTransformFeedbackVaryings );
-	
+
 	if( numActiveTransformFeedbackVaryings > 0 ) {
 		for( int i = 0; i < numActiveTransformFeedbackVaryings; i++ ) {
 			GLchar name[500];
 			GLint length;
 			GLsizei count;
 			GLenum type;
-			
+
 			glGetTransformFeedbackVarying( mHandle, i, 500, &length, &count, &type, name );
 			name[length] = 0;
-			
+
 			// So they've told us at setup what to look for. Find the varying, they told us
 			// about so that we can finish the setup.
-			auto varying = findTransformFeedbackVaryings( name );
-			if( varying ) {
-				varying->mCount = count;
-				varying->mType = type;
+			for( auto &varying : mTransformFeedbackVaryings ) {
+				if( varying.mName == name ) {
+					varying.mCount = count;
+					varying.mType = type;
+				}
 			}
 		}
 	}
@@ -998,28 +1463,35 @@ std::string GlslProg::getShaderLog( GLuint handle ) const
 	return log;
 }
 	
+bool GlslProg::isUniformLogged( const std::string &name ) const
+{
+	return threadLogDedup().testAndSet( logDedupKey( this, detail::constHash( name ) ) );
+}
+
 void GlslProg::logMissingUniform( const std::string &name ) const
 {
-	if( mLoggedUniformNames.count( name ) == 0 ) {
+	if( ! isUniformLogged( name ) ) {
 		CI_LOG_W( "Unknown uniform: \"" << name << "\"" );
-		mLoggedUniformNames.insert( name );
 	}
 }
 	
+void GlslProg::logMissingUniform( const UniformId &id ) const
+{
+	logMissingUniform( id.debugName ? string( id.debugName ) : string( "<unnamed UniformId>" ) );
+}
+
 void GlslProg::logMissingUniform( int location ) const
 {
-	if( mLoggedUniformLocations.count( location ) == 0 ) {
+	if( ! threadLogDedup().testAndSet( logDedupKey( this, (uint32_t)location ) ^ kLogDedupLocationSalt ) ) {
 		CI_LOG_W( "Unknown uniform location: \"" << location << "\"" );
-		mLoggedUniformLocations.insert( location );
 	}
 }
 	
 void GlslProg::logUniformWrongType( const std::string &name, GLenum uniformType, const std::string &userType ) const
 {
-	if( mLoggedUniformNames.count( name ) == 0 ) {
+	if( ! isUniformLogged( name ) ) {
 		CI_LOG_W("Uniform type mismatch for \"" << name << "\", expected "
 				 << gl::constantToString( uniformType ) << " and received " << userType );
-		mLoggedUniformNames.insert( name );
 	}
 }
 	
@@ -1053,26 +1525,14 @@ GLint GlslProg::getUniformLocation( const std::string &name ) const
 	
 GlslProg::Attribute* GlslProg::findAttrib( const std::string &name )
 {
-	Attribute *ret = nullptr;
-	for( auto &attrib : mAttributes ) {
-		if( attrib.mName == name ) {
-			ret = &attrib;
-			break;
-		}
-	}
-	return ret;
+	auto it = mAttribNameToIndex.find( name );
+	return ( it != mAttribNameToIndex.end() ) ? &mAttributes[it->second] : nullptr;
 }
 
 const GlslProg::Attribute* GlslProg::findAttrib( const std::string &name ) const
 {
-	const Attribute* ret = nullptr;
-	for( auto &attrib : mAttributes ) {
-		if( attrib.mName == name ) {
-			ret = &attrib;
-			break;
-		}
-	}
-	return ret;
+	auto it = mAttribNameToIndex.find( name );
+	return ( it != mAttribNameToIndex.end() ) ? &mAttributes[it->second] : nullptr;
 }
 	
 const GlslProg::Attribute* GlslProg::findAttrib( geom::Attrib semantic ) const
@@ -1090,13 +1550,13 @@ const GlslProg::Attribute* GlslProg::findAttrib( geom::Attrib semantic ) const
 const GlslProg::Uniform* GlslProg::findUniform( const std::string &name, int *resultLocation ) const
 {
 	// first check if there is an exact name match with mUniforms and simply return it if we find one
-	for( const auto & uniform : mUniforms ) {
-		if( uniform.mName == name ) {
-			if( resultLocation ) {
-				*resultLocation = uniform.mLoc;
-			}
-			return &uniform;
+	auto indexIt = mUniformNameToIndex.find( name );
+	if( indexIt != mUniformNameToIndex.end() ) {
+		const Uniform &uniform = mUniforms[indexIt->second];
+		if( resultLocation ) {
+			*resultLocation = uniform.mLoc;
 		}
+		return &uniform;
 	}
 
 	// search for array brackets, they need to be handled as a special case
@@ -1163,6 +1623,60 @@ const GlslProg::Uniform* GlslProg::findUniform( const std::string &name, int *re
 	return resultUniform;
 }
 
+const GlslProg::Uniform* GlslProg::findUniform( const UniformId &id, int *resultLocation ) const
+{
+	const size_t numUniforms = mUniforms.size();
+	size_t foundIndex = numUniforms;
+	// a 32-bit FNV-1a hash can collide, so a hash hit is confirmed against the stored name before
+	// use; the compare only runs on hits, leaving the hot path untouched
+	const auto confirmMatch = [this, &id]( size_t idx ) {
+		return ( ! id.debugName ) || ( mUniforms[idx].mName == id.debugName );
+	};
+#if defined( __AVX2__ )
+	// compare 8 precomputed name hashes per iteration; mUniformNameHashes is zero-padded so the
+	// final iteration stays in bounds, and the index check rejects a needle matching the padding
+	const uint32_t *hashes = mUniformNameHashes.data();
+	const __m256i needle = _mm256_set1_epi32( (int)id.hash );
+	for( size_t i = 0; i < numUniforms && foundIndex == numUniforms; i += 8 ) {
+		const __m256i chunk = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( hashes + i ) );
+		int mask = _mm256_movemask_epi8( _mm256_cmpeq_epi32( chunk, needle ) );
+		while( mask ) {
+#if defined( _MSC_VER )
+			unsigned long bit;
+			_BitScanForward( &bit, (unsigned long)mask );
+#else
+			const int bit = __builtin_ctz( (unsigned)mask );
+#endif
+			const size_t idx = i + ( bit >> 2 );
+			if( idx < numUniforms && confirmMatch( idx ) ) {
+				foundIndex = idx;
+				break;
+			}
+			mask &= ~( 0xF << ( bit & ~3 ) ); // clear the rejected lane and keep scanning
+		}
+	}
+#else
+	for( size_t i = 0; i < numUniforms; ++i ) {
+		if( mUniformNameHashes[i] == id.hash && confirmMatch( i ) ) {
+			foundIndex = i;
+			break;
+		}
+	}
+#endif
+	if( foundIndex < numUniforms ) {
+		const Uniform &uniform = mUniforms[foundIndex];
+		if( resultLocation )
+			*resultLocation = uniform.mLoc;
+		return &uniform;
+	}
+
+	// no hash match; the requested name may use array-index syntax ("example[2]"), which the string path handles
+	if( id.debugName )
+		return findUniform( string( id.debugName ), resultLocation );
+
+	return nullptr;
+}
+
 const GlslProg::Uniform* GlslProg::findUniform( int location, int *resultLocation ) const
 {
 	const Uniform* ret = nullptr;
@@ -1215,30 +1729,21 @@ GLint GlslProg::getAttribLocation( const std::string &name ) const
 
 GlslProg::UniformBlock* GlslProg::findUniformBlock( const std::string &name )
 {
-	UniformBlock *ret = nullptr;
-	for( auto &uniformBlock : mUniformBlocks ) {
-		if( uniformBlock.mName == name ) {
-			ret = &uniformBlock;
-			break;
-		}
-	}
-	return ret;
+	cacheActiveUniformBlocks();
+	auto it = mUniformBlockNameToIndex.find( name );
+	return ( it != mUniformBlockNameToIndex.end() ) ? &mUniformBlocks[it->second] : nullptr;
 }
-	
+
 const GlslProg::UniformBlock* GlslProg::findUniformBlock( const std::string &name ) const
 {
-	const UniformBlock *ret = nullptr;
-	for( auto &uniformBlock : mUniformBlocks ) {
-		if( uniformBlock.mName == name ) {
-			ret = &uniformBlock;
-			break;
-		}
-	}
-	return ret;
+	cacheActiveUniformBlocks();
+	auto it = mUniformBlockNameToIndex.find( name );
+	return ( it != mUniformBlockNameToIndex.end() ) ? &mUniformBlocks[it->second] : nullptr;
 }
 
 void GlslProg::uniformBlock( int loc, int binding ) const
 {
+	cacheActiveUniformBlocks();
 	auto found = find_if( mUniformBlocks.begin(), mUniformBlocks.end(),
 						 [loc]( const UniformBlock &block ) {
 							 return block.mLoc == loc;
@@ -1280,6 +1785,7 @@ GLint GlslProg::getUniformBlockLocation( const std::string &name ) const
 
 GLint GlslProg::getUniformBlockSize( GLint blockBinding ) const
 {
+	cacheActiveUniformBlocks();
 	auto found = find_if( mUniformBlocks.begin(), mUniformBlocks.end(),
 						 [=]( const UniformBlock &block ) {
 							 return block.mBlockBinding == blockBinding;
@@ -1296,6 +1802,7 @@ GLint GlslProg::getUniformBlockSize( GLint blockBinding ) const
 
 const GlslProg::TransformFeedbackVaryings* GlslProg::findTransformFeedbackVaryings( const std::string &name ) const
 {
+	cacheActiveTransformFeedbackVaryings();
 	const TransformFeedbackVaryings *ret = nullptr;
 	for( const auto &varying : mTransformFeedbackVaryings ) {
 		if( varying.mName == name ) {
@@ -1307,6 +1814,7 @@ const GlslProg::TransformFeedbackVaryings* GlslProg::findTransformFeedbackVaryin
 	
 GlslProg::TransformFeedbackVaryings* GlslProg::findTransformFeedbackVaryings( const std::string &name )
 {
+	cacheActiveTransformFeedbackVaryings();
 	TransformFeedbackVaryings *ret = nullptr;
 	for( auto &varying : mTransformFeedbackVaryings ) {
 		if( varying.mName == name ) {
@@ -1320,12 +1828,104 @@ GlslProg::TransformFeedbackVaryings* GlslProg::findTransformFeedbackVaryings( co
 
 bool GlslProg::checkUniformValueCache( const Uniform &uniform, int location, const void *val, int count ) const
 {
-	if( mUniformValueCache )
-		return mUniformValueCache->shouldBuffer( uniform.mBytePointer, uniform.mTypeSize, location - uniform.mLoc, count, val );
+	ShaderState &state = shaderState();
+	if( state.mUniformValueCache )
+		return state.mUniformValueCache->shouldBuffer( uniform.mBytePointer, uniform.mTypeSize, location - uniform.mLoc, count, val );
 	else // no uniform cache means we've disabled it
 		return true;
 }
-	
+
+namespace {
+
+// Untyped glUniform* wrappers captured into baked pusher entries; the matrix variants never transpose.
+typedef void (*UniformSetter)( GLint location, GLsizei count, const GLvoid *data );
+
+void setUniform1iv( GLint loc, GLsizei count, const GLvoid *v )		{ glUniform1iv( loc, count, reinterpret_cast<const GLint*>( v ) ); }
+void setUniform2iv( GLint loc, GLsizei count, const GLvoid *v )		{ glUniform2iv( loc, count, reinterpret_cast<const GLint*>( v ) ); }
+void setUniform3iv( GLint loc, GLsizei count, const GLvoid *v )		{ glUniform3iv( loc, count, reinterpret_cast<const GLint*>( v ) ); }
+void setUniform4iv( GLint loc, GLsizei count, const GLvoid *v )		{ glUniform4iv( loc, count, reinterpret_cast<const GLint*>( v ) ); }
+#if ! defined( CINDER_GL_ES_2 )
+void setUniform1uiv( GLint loc, GLsizei count, const GLvoid *v )	{ glUniform1uiv( loc, count, reinterpret_cast<const GLuint*>( v ) ); }
+void setUniform2uiv( GLint loc, GLsizei count, const GLvoid *v )	{ glUniform2uiv( loc, count, reinterpret_cast<const GLuint*>( v ) ); }
+void setUniform3uiv( GLint loc, GLsizei count, const GLvoid *v )	{ glUniform3uiv( loc, count, reinterpret_cast<const GLuint*>( v ) ); }
+void setUniform4uiv( GLint loc, GLsizei count, const GLvoid *v )	{ glUniform4uiv( loc, count, reinterpret_cast<const GLuint*>( v ) ); }
+#endif
+void setUniform1fv( GLint loc, GLsizei count, const GLvoid *v )		{ glUniform1fv( loc, count, reinterpret_cast<const GLfloat*>( v ) ); }
+void setUniform2fv( GLint loc, GLsizei count, const GLvoid *v )		{ glUniform2fv( loc, count, reinterpret_cast<const GLfloat*>( v ) ); }
+void setUniform3fv( GLint loc, GLsizei count, const GLvoid *v )		{ glUniform3fv( loc, count, reinterpret_cast<const GLfloat*>( v ) ); }
+void setUniform4fv( GLint loc, GLsizei count, const GLvoid *v )		{ glUniform4fv( loc, count, reinterpret_cast<const GLfloat*>( v ) ); }
+void setUniformMatrix2fv( GLint loc, GLsizei count, const GLvoid *v )	{ glUniformMatrix2fv( loc, count, GL_FALSE, reinterpret_cast<const GLfloat*>( v ) ); }
+void setUniformMatrix3fv( GLint loc, GLsizei count, const GLvoid *v )	{ glUniformMatrix3fv( loc, count, GL_FALSE, reinterpret_cast<const GLfloat*>( v ) ); }
+void setUniformMatrix4fv( GLint loc, GLsizei count, const GLvoid *v )	{ glUniformMatrix4fv( loc, count, GL_FALSE, reinterpret_cast<const GLfloat*>( v ) ); }
+
+UniformSetter uniformSetterForTag( uint8_t typeTag )
+{
+	switch( typeTag ) {
+		// bool uniforms are pushed as int32_t members; samplers collapsed to UNIFORM_TYPE_TAG_INT when cached
+		case UNIFORM_TYPE_TAG_BOOL:
+		case UNIFORM_TYPE_TAG_INT:		return &setUniform1iv;
+		case UNIFORM_TYPE_TAG_BVEC2:
+		case UNIFORM_TYPE_TAG_IVEC2:	return &setUniform2iv;
+		case UNIFORM_TYPE_TAG_BVEC3:
+		case UNIFORM_TYPE_TAG_IVEC3:	return &setUniform3iv;
+		case UNIFORM_TYPE_TAG_BVEC4:
+		case UNIFORM_TYPE_TAG_IVEC4:	return &setUniform4iv;
+#if ! defined( CINDER_GL_ES_2 )
+		case UNIFORM_TYPE_TAG_UINT:		return &setUniform1uiv;
+		case UNIFORM_TYPE_TAG_UVEC2:	return &setUniform2uiv;
+		case UNIFORM_TYPE_TAG_UVEC3:	return &setUniform3uiv;
+		case UNIFORM_TYPE_TAG_UVEC4:	return &setUniform4uiv;
+#endif
+		case UNIFORM_TYPE_TAG_FLOAT:	return &setUniform1fv;
+		case UNIFORM_TYPE_TAG_VEC2:		return &setUniform2fv;
+		case UNIFORM_TYPE_TAG_VEC3:		return &setUniform3fv;
+		case UNIFORM_TYPE_TAG_VEC4:		return &setUniform4fv;
+		case UNIFORM_TYPE_TAG_MAT2:		return &setUniformMatrix2fv;
+		case UNIFORM_TYPE_TAG_MAT3:		return &setUniformMatrix3fv;
+		case UNIFORM_TYPE_TAG_MAT4:		return &setUniformMatrix4fv;
+		default:						return nullptr;
+	}
+}
+
+} // anonymous namespace
+
+GlslProg::UniformPusher GlslProg::makeUniformPusher( const std::vector<UniformBinding> &bindings ) const
+{
+	struct BakedUniform {
+		UniformSetter	mSetter;
+		GLint			mLoc;
+		size_t			mByteOffset;
+		GLsizei			mCount;
+		uint32_t		mUniformIndex; // into mUniforms, for the value cache
+	};
+
+	std::vector<BakedUniform> baked;
+	baked.reserve( bindings.size() );
+	for( const auto &binding : bindings ) {
+		int uniformLocation = -1;
+		const Uniform *found = findUniform( binding.mUniformName, &uniformLocation );
+		if( ! found ) {
+			logMissingUniform( binding.mUniformName );
+			continue;
+		}
+		UniformSetter setter = uniformSetterForTag( found->mTypeTag );
+		if( ! setter ) {
+			CI_LOG_W( "Uniform \"" << binding.mUniformName << "\" has a type unsupported by makeUniformPusher, skipping binding" );
+			continue;
+		}
+		baked.push_back( { setter, uniformLocation, binding.mByteOffset, found->mCount, (uint32_t)( found - mUniforms.data() ) } );
+	}
+
+	return [this, baked]( const void *uniformStruct ) {
+		const uint8_t *base = reinterpret_cast<const uint8_t*>( uniformStruct );
+		for( const auto &entry : baked ) {
+			const void *value = base + entry.mByteOffset;
+			if( checkUniformValueCache( mUniforms[entry.mUniformIndex], entry.mLoc, value, entry.mCount ) )
+				entry.mSetter( entry.mLoc, entry.mCount, value );
+		}
+	};
+}
+
 template<typename LookUp, typename T>
 inline void GlslProg::uniformImpl( const LookUp &lookUp, const T &data ) const
 {
@@ -1381,7 +1981,7 @@ inline void	GlslProg::uniformMatImpl( const LookUp &lookUp, const T *data, int c
 template<typename T>
 inline bool GlslProg::validateUniform( const Uniform &uniform, int uniformLocation, const T &val ) const
 {
-	if( ! checkUniformType<T>( uniform.mType ) ) {
+	if( ! uniformTypeTagMatches<T>( uniform.mTypeTag ) && ! checkUniformType<T>( uniform.mType ) ) {
 		logUniformWrongType( uniform.mName, uniform.mType, cppTypeToGlslTypeName<T>() );
 		return false;
 	}
@@ -1393,7 +1993,7 @@ inline bool GlslProg::validateUniform( const Uniform &uniform, int uniformLocati
 template<typename T>
 inline bool GlslProg::validateUniform( const Uniform &uniform, int uniformLocation, const T *val, int count ) const
 {
-	if( ! checkUniformType<T>( uniform.mType ) ) {
+	if( ! uniformTypeTagMatches<T>( uniform.mTypeTag ) && ! checkUniformType<T>( uniform.mType ) ) {
 		logUniformWrongType( uniform.mName, uniform.mType, cppTypeToGlslTypeName<T>() + "[" + std::to_string( count ) + "]" );
 		return false;
 	}
@@ -1971,6 +2571,139 @@ void GlslProg::uniformMatFunc( int location, const mat4 *data, int count, bool t
     glUniformMatrix4fv( location, count, ( transpose ) ? GL_TRUE : GL_FALSE, glm::value_ptr( *data ) );
 }
 
+// UniformId variants
+void GlslProg::uniform( const UniformId &id, bool data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, int data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, float data ) const
+{
+	uniformImpl( id, data );
+}
+
+#if ! defined( CINDER_GL_ES_2 )
+void GlslProg::uniform( const UniformId &id, uint32_t data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const uvec2 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const uvec3 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const uvec4 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const uint32_t *data, int count ) const
+{
+	uniformImpl( id, data, count );
+}
+#endif // ! defined( CINDER_GL_ES_2 )
+
+void GlslProg::uniform( const UniformId &id, const vec2 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const vec3 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const vec4 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const ivec2 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const ivec3 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const ivec4 &data ) const
+{
+	uniformImpl( id, data );
+}
+
+void GlslProg::uniform( const UniformId &id, const mat2 &data, bool transpose ) const
+{
+	uniformMatImpl( id, data, transpose );
+}
+
+void GlslProg::uniform( const UniformId &id, const mat3 &data, bool transpose ) const
+{
+	uniformMatImpl( id, data, transpose );
+}
+
+void GlslProg::uniform( const UniformId &id, const mat4 &data, bool transpose ) const
+{
+	uniformMatImpl( id, data, transpose );
+}
+
+void GlslProg::uniform( const UniformId &id, const int *data, int count ) const
+{
+	uniformImpl( id, data, count );
+}
+
+void GlslProg::uniform( const UniformId &id, const float *data, int count ) const
+{
+	uniformImpl( id, data, count );
+}
+
+void GlslProg::uniform( const UniformId &id, const ivec2 *data, int count ) const
+{
+	uniformImpl( id, data, count );
+}
+
+void GlslProg::uniform( const UniformId &id, const vec2 *data, int count ) const
+{
+	uniformImpl( id, data, count );
+}
+
+void GlslProg::uniform( const UniformId &id, const vec3 *data, int count ) const
+{
+	uniformImpl( id, data, count );
+}
+
+void GlslProg::uniform( const UniformId &id, const vec4 *data, int count ) const
+{
+	uniformImpl( id, data, count );
+}
+
+void GlslProg::uniform( const UniformId &id, const mat2 *data, int count, bool transpose ) const
+{
+	uniformMatImpl( id, data, count, transpose );
+}
+
+void GlslProg::uniform( const UniformId &id, const mat3 *data, int count, bool transpose ) const
+{
+	uniformMatImpl( id, data, count, transpose );
+}
+
+void GlslProg::uniform( const UniformId &id, const mat4 *data, int count, bool transpose ) const
+{
+	uniformMatImpl( id, data, count, transpose );
+}
+
 std::ostream& operator<<( std::ostream &os, const GlslProg &rhs )
 {
 	os << "ID: " << rhs.mHandle << std::endl;
@@ -2048,7 +2781,7 @@ GlslProgCompileExc::GlslProgCompileExc( const std::string &log, GLint shaderType
 		default:						typeString = "UNKNOWN: ";
 	}
 
-	setDescription( typeString + log );
+	setLog( typeString + log );
 }
 	
 } } // namespace cinder::gl
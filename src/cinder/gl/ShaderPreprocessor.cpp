@@ -27,6 +27,9 @@
 #include "cinder/Utilities.h"
 #include "cinder/Log.h"
 
+#include <mutex>
+#include <unordered_map>
+
 using namespace std;
 
 namespace cinder { namespace gl {
@@ -148,6 +151,40 @@ bool findVersionStatement( const char *lineStart, int *versionNumberOut )
 		*versionNumberOut = (int)std::strtol( c, nullptr, 0 );
 	return true;
 }
+
+uint64_t fnv1a64( const std::string &str, uint64_t hash = 14695981039346656037ull )
+{
+	for( const char c : str )
+		hash = ( hash ^ (uint64_t)(uint8_t)c ) * 1099511628211ull;
+	return hash;
+}
+
+int64_t lastWriteTimestamp( const fs::path &path )
+{
+	try {
+#if defined( CINDER_UWP ) || ( defined( _MSC_VER ) && ( _MSC_VER >= 1900 ) )
+		return static_cast<int64_t>( fs::last_write_time( path ).time_since_epoch().count() );
+#else
+		return static_cast<int64_t>( fs::last_write_time( path ) );
+#endif
+	}
+	catch( ... ) {
+		return -1;
+	}
+}
+
+// Parsed sources are cached across ShaderPreprocessor instances (each GlslProg::Format creates its own),
+// keyed on everything that affects the output, and revalidated against the #include'd files' write times.
+struct ParsedSourceCacheEntry {
+	string										parsedSource;
+	set<fs::path>								includedFiles;
+	vector<pair<fs::path,int64_t>>				includeTimestamps;
+};
+
+mutex										sParsedSourceCacheMutex;
+unordered_map<uint64_t,ParsedSourceCacheEntry>	sParsedSourceCache;
+bool										sParsedSourceCacheEnabled = true;
+
 } // anonymous namespace
 
 ShaderPreprocessor::ShaderPreprocessor()
@@ -178,6 +215,27 @@ string ShaderPreprocessor::parse( const fs::path &sourcePath, std::set<fs::path>
 
 string ShaderPreprocessor::parse( const std::string &source, const fs::path &sourcePath, set<fs::path> *includedFiles )
 {
+	const uint64_t cacheKey = makeCacheKey( source, sourcePath ); // 0 when this parse can't be cached
+	if( cacheKey ) {
+		lock_guard<mutex> lock( sParsedSourceCacheMutex );
+		auto cached = sParsedSourceCache.find( cacheKey );
+		if( cached != sParsedSourceCache.end() ) {
+			bool current = true;
+			for( const auto &stamp : cached->second.includeTimestamps ) {
+				if( lastWriteTimestamp( stamp.first ) != stamp.second ) {
+					current = false;
+					break;
+				}
+			}
+			if( current ) {
+				if( includedFiles )
+					*includedFiles = cached->second.includedFiles;
+				return cached->second.parsedSource;
+			}
+			sParsedSourceCache.erase( cached ); // an included file changed on disk; reparse
+		}
+	}
+
 	set<fs::path> localIncludeTree; // even if user didn't ask for includedFiles, keep track of them to detect recursion
 	if( ! includedFiles )
 		includedFiles = &localIncludeTree;
@@ -190,15 +248,68 @@ string ShaderPreprocessor::parse( const std::string &source, const fs::path &sou
 	int lineNumberStart;
 
 	parseDirectives( source, sourcePath, &directives, &sourceBody, &versionNumber, &lineNumberStart );
+
+	string result;
 	if( directives.empty() ) {
 		// There were no directives added, parse original source for includes
-		return parseTopLevel( source, sourcePath, lineNumberStart, versionNumber, *includedFiles );
+		result = parseTopLevel( source, sourcePath, lineNumberStart, versionNumber, *includedFiles );
 	}
 	else {
 		// Parse the remaining source and then append it to the directives string
-		string result = parseTopLevel( sourceBody, sourcePath, lineNumberStart, versionNumber, *includedFiles );
-		return directives + result;
+		result = directives + parseTopLevel( sourceBody, sourcePath, lineNumberStart, versionNumber, *includedFiles );
 	}
+
+	if( cacheKey ) {
+		ParsedSourceCacheEntry entry;
+		entry.parsedSource = result;
+		entry.includedFiles = *includedFiles;
+		for( const fs::path &includePath : *includedFiles )
+			entry.includeTimestamps.push_back( { includePath, lastWriteTimestamp( includePath ) } );
+
+		lock_guard<mutex> lock( sParsedSourceCacheMutex );
+		sParsedSourceCache[cacheKey] = move( entry );
+	}
+
+	return result;
+}
+
+uint64_t ShaderPreprocessor::makeCacheKey( const std::string &source, const fs::path &sourcePath ) const
+{
+	// a custom include handler can supply contents that no file timestamp tracks, so never cache those parses
+	if( ( ! sParsedSourceCacheEnabled ) || mSignalInclude.getNumSlots() > 0 )
+		return 0;
+
+	uint64_t hash = fnv1a64( source );
+	hash = fnv1a64( sourcePath.string(), hash );
+	for( const auto &define : mDefineDirectives ) {
+		hash = fnv1a64( define.first, hash );
+		hash = fnv1a64( define.second, hash );
+	}
+	hash = fnv1a64( to_string( mVersion ), hash );
+	hash = fnv1a64( mUseFilenameInLineDirective ? "1" : "0", hash );
+	for( const auto &directory : mSearchDirectories )
+		hash = fnv1a64( directory.string(), hash );
+
+	return hash ? hash : 1; // reserve 0 to mean "not cacheable"
+}
+
+void ShaderPreprocessor::setCachingEnabled( bool enable )
+{
+	lock_guard<mutex> lock( sParsedSourceCacheMutex );
+	sParsedSourceCacheEnabled = enable;
+	if( ! enable )
+		sParsedSourceCache.clear();
+}
+
+bool ShaderPreprocessor::isCachingEnabled()
+{
+	return sParsedSourceCacheEnabled;
+}
+
+void ShaderPreprocessor::clearCache()
+{
+	lock_guard<mutex> lock( sParsedSourceCacheMutex );
+	sParsedSourceCache.clear();
 }
 
 // - returns directives string and remaining source separately, so that parseTopLevel can start after the directives we've added
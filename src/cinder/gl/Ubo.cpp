@@ -36,7 +36,22 @@ UboRef Ubo::create( GLsizeiptr allocationSize, const void *data, GLenum usage )
 {
 	return UboRef( new Ubo( allocationSize, data, usage ) );
 }
-	
+
+#if defined( CINDER_GL_HAS_BUFFER_STORAGE )
+UboRef Ubo::createPersistent( GLsizeiptr allocationSize, GLbitfield flags )
+{
+	if( ! glBufferStorage ) // requires OpenGL 4.4 or ARB_buffer_storage
+		return UboRef();
+
+	UboRef result( new Ubo() );
+	result->bufferStorage( allocationSize, nullptr, flags );
+	if( ! result->mapPersistent( flags ) )
+		return UboRef();
+
+	return result;
+}
+#endif
+
 Ubo::Ubo()
 	: BufferObj( GL_UNIFORM_BUFFER )
 {
@@ -54,6 +69,11 @@ void Ubo::bindBufferBase( GLuint index )
 	context()->bindBufferBase( mTarget, index, mId );
 }
 
+void Ubo::bindBufferRange( GLuint index, GLintptr offset, GLsizeiptr size )
+{
+	context()->bindBufferRange( mTarget, index, mId, offset, size );
+}
+
 } } // namespace cinder::gl
 
 #endif // ! defined( CINDER_GL_ES_2 )
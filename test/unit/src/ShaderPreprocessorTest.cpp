@@ -5,9 +5,27 @@
 #include "cinder/Utilities.h"
 #include "cinder/app/App.h"
 
+#include <fstream>
+
 using namespace std;
 using namespace ci;
 
+namespace {
+
+// pushes a file's write time 1 second into the future, so that cached parses keyed on it go stale
+// even on filesystems with coarse timestamp granularity
+void bumpWriteTime( const fs::path &fullPath )
+{
+#if defined( CINDER_POSIX )
+	// TODO: remove this path, once std::filesystem is available accross the board
+	fs::last_write_time( fullPath, fs::last_write_time( fullPath ) + 1 );
+#else
+	fs::last_write_time( fullPath, fs::last_write_time( fullPath ) + 1s );
+#endif
+}
+
+} // anonymous namespace
+
 TEST_CASE( "ShaderPreprocessor" )
 {
 	SECTION( "test simple parse filepath with include" )
@@ -142,4 +160,121 @@ TEST_CASE( "ShaderPreprocessor" )
 		REQUIRE( includedFiles.size() == 1 );
 		REQUIRE( includedFiles.count( "commonSimple.glsl" ) == 1 );
 	}
+
+	SECTION( "test parse cache returns the cached result" )
+	{
+		gl::ShaderPreprocessor::clearCache();
+		REQUIRE( gl::ShaderPreprocessor::isCachingEnabled() );
+
+		fs::path sourcePath = app::getAssetPath( "shader_preprocessor/simple.frag" );
+		fs::path commonSimplePath = fs::canonical( app::getAssetPath( "shader_preprocessor/commonSimple.glsl" ) );
+
+		gl::ShaderPreprocessor preprocessor;
+		std::set<fs::path> includedFiles;
+		const string first = preprocessor.parse( sourcePath, &includedFiles );
+
+		// the cache is shared across instances; a second parse returns the cached result and
+		// still reports the include set
+		gl::ShaderPreprocessor preprocessor2;
+		std::set<fs::path> includedFiles2;
+		const string second = preprocessor2.parse( sourcePath, &includedFiles2 );
+
+		REQUIRE( second == first );
+		REQUIRE( includedFiles2.size() == 1 );
+		REQUIRE( includedFiles2.count( commonSimplePath ) == 1 );
+	}
+
+	SECTION( "test cache invalidation when an included file changes" )
+	{
+		gl::ShaderPreprocessor::clearCache();
+		gl::ShaderPreprocessor preprocessor;
+
+		fs::path sourcePath = app::getAssetPath( "shader_preprocessor/simple.frag" );
+		fs::path commonSimplePath = fs::canonical( app::getAssetPath( "shader_preprocessor/commonSimple.glsl" ) );
+
+		const string result = preprocessor.parse( sourcePath );
+		REQUIRE( result.find( "fract( sin( n ) * 43758.5453 )" ) != string::npos );
+
+		// rewrite the included file so the cached entry's write timestamp is stale
+		const string originalContents = loadString( loadFile( commonSimplePath ) );
+		{
+			std::ofstream out( commonSimplePath.string().c_str(), std::ios::trunc );
+			out << originalContents << "\nfloat cacheInvalidationMarker() { return 0.0; }\n";
+		}
+		bumpWriteTime( commonSimplePath );
+
+		const string updated = preprocessor.parse( sourcePath );
+
+		// restore the asset before asserting, so a failure doesn't leave it modified
+		{
+			std::ofstream out( commonSimplePath.string().c_str(), std::ios::trunc );
+			out << originalContents;
+		}
+		gl::ShaderPreprocessor::clearCache();
+
+		REQUIRE( updated.find( "cacheInvalidationMarker" ) != string::npos );
+	}
+
+	SECTION( "test disabling the cache" )
+	{
+		REQUIRE( gl::ShaderPreprocessor::isCachingEnabled() );
+		gl::ShaderPreprocessor::setCachingEnabled( false );
+		REQUIRE( ! gl::ShaderPreprocessor::isCachingEnabled() );
+
+		fs::path sourcePath = app::getAssetPath( "shader_preprocessor/simple.frag" );
+		fs::path commonSimplePath = fs::canonical( app::getAssetPath( "shader_preprocessor/commonSimple.glsl" ) );
+
+		gl::ShaderPreprocessor preprocessor;
+		std::set<fs::path> includedFiles;
+		const string result = preprocessor.parse( sourcePath, &includedFiles );
+
+		REQUIRE( result.find( "fract( sin( n ) * 43758.5453 )" ) != string::npos );
+		REQUIRE( includedFiles.size() == 1 );
+		REQUIRE( includedFiles.count( commonSimplePath ) == 1 );
+
+		gl::ShaderPreprocessor::setCachingEnabled( true );
+		gl::ShaderPreprocessor::clearCache();
+
+		const string uncached = preprocessor.parse( sourcePath );
+		REQUIRE( uncached == result );
+	}
+
+	SECTION( "test include handler bypasses the cache" )
+	{
+		gl::ShaderPreprocessor::clearCache();
+		fs::path sourcePath = app::getAssetPath( "shader_preprocessor/simple.frag" );
+
+		// populate the cache with the on-disk include
+		gl::ShaderPreprocessor cachingPreprocessor;
+		const string fromDisk = cachingPreprocessor.parse( sourcePath );
+		REQUIRE( fromDisk.find( "fract( sin( n ) * 43758.5453 )" ) != string::npos );
+
+		const std::string commonGlsl = R"(
+		float hash( float n )
+		{
+			return 0.5f;
+		}
+		)";
+
+		// a preprocessor with an include handler must not be served the cached on-disk result
+		gl::ShaderPreprocessor handlerPreprocessor;
+		handlerPreprocessor.getSignalInclude().connect(
+			[&commonGlsl]( const fs::path &path, std::string *source ) {
+				if( path == fs::path( "commonSimple.glsl" ) ) {
+					*source = commonGlsl;
+					return true;
+				}
+
+				return false;
+			}
+		);
+
+		const string fromHandler = handlerPreprocessor.parse( sourcePath );
+		REQUIRE( fromHandler.find( "return 0.5f;" ) != string::npos );
+		REQUIRE( fromHandler.find( "43758.5453" ) == string::npos );
+
+		// and the handler parse must not have polluted the cache for file-based parses
+		const string fromDiskAgain = cachingPreprocessor.parse( sourcePath );
+		REQUIRE( fromDiskAgain == fromDisk );
+	}
 }